@@ -36,6 +36,11 @@
 #include <AMReX_PlotFileUtil.H>
 #include <AMReX_Print.H>
 
+#ifdef AMREX_USE_EB
+#include <AMReX_EB2.H>
+#include <AMReX_EBAmrUtil.H>
+#endif
+
 #ifdef AMREX_USE_FBOXLIB_MG
 #include <mg_cpp_f.h>
 #endif
@@ -114,6 +119,7 @@ namespace
     int  checkpoint_nfiles;
     int  regrid_on_restart;
     int  use_efficient_regrid;
+    int  incremental_regrid;
     int  plotfile_on_restart;
     int  insitu_on_restart;
     int  checkpoint_on_restart;
@@ -133,6 +139,12 @@ Amr::UsingPrecreateDirectories()
     return precreateDirectories;
 }
 
+bool
+Amr::UsingIncrementalRegrid ()
+{
+    return incremental_regrid;
+}
+
 void
 Amr::Initialize ()
 {
@@ -149,6 +161,7 @@ Amr::Initialize ()
     checkpoint_nfiles        = 64;
     regrid_on_restart        = 0;
     use_efficient_regrid     = 0;
+    incremental_regrid       = 0;
     plotfile_on_restart      = 0;
     insitu_on_restart        = 0;
     checkpoint_on_restart    = 0;
@@ -288,6 +301,12 @@ Amr::InitAmr ()
     //
     pp.query("regrid_on_restart",regrid_on_restart);
     pp.query("use_efficient_regrid",use_efficient_regrid);
+    pp.query("incremental_regrid",incremental_regrid);
+    {
+        int time_interp_cache = 0;
+        pp.query("time_interp_cache",time_interp_cache);
+        StateData::SetInterpCacheSize(time_interp_cache);
+    }
     pp.query("plotfile_on_restart",plotfile_on_restart);
     pp.query("insitu_on_restart",insitu_on_restart);
     pp.query("checkpoint_on_restart",checkpoint_on_restart);
@@ -519,6 +538,11 @@ Amr::InitAmr ()
 
     loadbalance_max_fac = 1.5;
     pp.query("loadbalance_max_fac", loadbalance_max_fac);
+
+    loadbalance_with_eb_costs = 0;
+#ifdef AMREX_USE_EB
+    pp.query("loadbalance_with_eb_costs", loadbalance_with_eb_costs);
+#endif
 }
 
 int
@@ -1927,20 +1951,10 @@ Amr::RegridOnly (Real time)
 }
 
 void
-Amr::timeStep (int  level,
-               Real time,
-               int  iteration,
-               int  niter,
-               Real stop_time)
+Amr::timeStepPreAdvance (int  level,
+                          Real time,
+                          Real stop_time)
 {
-#ifdef USE_PERILLA
-    perilla::syncAllWorkerThreads();
-    if(perilla::isMasterThread())
-    {
-#endif
-    BL_PROFILE("Amr::timeStep()");
-    BL_COMM_PROFILE_NAMETAG("Amr::timeStep TOP");
-
     // This is used so that the AmrLevel functions can know which level is being advanced 
     //      when regridding is called with possible lbase > level.
     which_level_being_advanced = level;
@@ -2070,22 +2084,14 @@ memcheck.report();
 	amrex::Print() << "[Level " << level << " step " << level_steps[level]+1 << "] "
 		       << "ADVANCE with dt = " << dt_level[level] << "\n";
     }
+}
 
-#ifdef USE_PERILLA
-    }
-    perilla::syncAllWorkerThreads();
-#endif
-
-    BL_PROFILE_REGION_START("amr_level.advance");
-    Real dt_new = amr_level[level]->advance(time,dt_level[level],iteration,niter);
-    BL_PROFILE_REGION_STOP("amr_level.advance");
-
-#ifdef USE_PERILLA
-    perilla::syncWorkerThreads();
-    if(perilla::isMasterThread())
-    {
-#endif
-
+void
+Amr::timeStepPostAdvance (int  level,
+                           Real time,
+                           int  iteration,
+                           Real dt_new)
+{
     dt_min[level] = iteration == 1 ? dt_new : std::min(dt_min[level],dt_new);
 
     level_steps[level]++;
@@ -2120,6 +2126,41 @@ memcheck.report();
 //        getLevel(level).initPerilla(cumtime);
 #endif
     }
+}
+
+void
+Amr::timeStep (int  level,
+               Real time,
+               int  iteration,
+               int  niter,
+               Real stop_time)
+{
+#ifdef USE_PERILLA
+    perilla::syncAllWorkerThreads();
+    if(perilla::isMasterThread())
+    {
+#endif
+    BL_PROFILE("Amr::timeStep()");
+    BL_COMM_PROFILE_NAMETAG("Amr::timeStep TOP");
+
+    timeStepPreAdvance(level, time, stop_time);
+
+#ifdef USE_PERILLA
+    }
+    perilla::syncAllWorkerThreads();
+#endif
+
+    BL_PROFILE_REGION_START("amr_level.advance");
+    Real dt_new = amr_level[level]->advance(time,dt_level[level],iteration,niter);
+    BL_PROFILE_REGION_STOP("amr_level.advance");
+
+#ifdef USE_PERILLA
+    perilla::syncWorkerThreads();
+    if(perilla::isMasterThread())
+    {
+#endif
+
+    timeStepPostAdvance(level, time, iteration, dt_new);
 
 #ifdef USE_PERILLA
     }
@@ -2637,7 +2678,7 @@ Amr::defBaseLevel (Real              strt_time,
     }
 
     this->SetBoxArray(0, lev0);
-    this->SetDistributionMap(0, DistributionMapping(lev0));
+    this->SetDistributionMap(0, makeDefaultDistributionMap(0, lev0));
 
     //
     // Now build level 0 grids.
@@ -2697,6 +2738,15 @@ Amr::regrid (int  lbase,
 	return;
     }
 
+    if (!initial && !regrid_level_zero && NewGridsWithinTolerance(lbase, new_finest, new_grid_places))
+    {
+	if (verbose > 0) {
+	    amrex::Print() << "Regridding at level lbase = " << lbase
+			   << " but new grids within regrid_tolerance\n";
+	}
+	return;
+    }
+
     //
     // Reclaim old-time grid space for all remain levels > lbase.
     //
@@ -2728,13 +2778,16 @@ Amr::regrid (int  lbase,
         // Construct skeleton of new level.
         //
 
+        BL_PROFILE_VAR("Amr::regrid::distribution()", amr_regrid_dm);
         if (loadbalance_with_workestimates && !initial) {
             new_dmap[lev] = makeLoadBalanceDistributionMap(lev, time, new_grid_places[lev]);
         }
         else if (new_dmap[lev].empty()) {
-	    new_dmap[lev].define(new_grid_places[lev]);
+	    new_dmap[lev] = makeDefaultDistributionMap(lev, new_grid_places[lev]);
 	}
+        BL_PROFILE_VAR_STOP(amr_regrid_dm);
 
+        BL_PROFILE_VAR("Amr::regrid::data()", amr_regrid_data);
         AmrLevel* a = (*levelbld)(*this,lev,Geom(lev),new_grid_places[lev],
 				  new_dmap[lev],cumtime);
 
@@ -2769,6 +2822,7 @@ Amr::regrid (int  lbase,
 	    this->SetBoxArray(lev, amr_level[lev]->boxArray());
 	    this->SetDistributionMap(lev, amr_level[lev]->DistributionMap());
         }
+        BL_PROFILE_VAR_STOP(amr_regrid_data);
 
     }
 
@@ -2845,7 +2899,7 @@ Amr::makeLoadBalanceDistributionMap (int lev, Real time, const BoxArray& ba) con
         if (verbose) {
             amrex::Print() << "\nAMREX WARNING: work estimates type does not exist!\n\n";
         }
-        newdm.define(ba);
+        newdm = makeDefaultDistributionMap(lev, ba);
     }
     else if (amr_level[lev])
     {
@@ -2859,19 +2913,36 @@ Amr::makeLoadBalanceDistributionMap (int lev, Real time, const BoxArray& ba) con
         MultiFab workest(ba, dmtmp, 1, 0, MFInfo(), FArrayBoxFactory());
         AmrLevel::FillPatch(*amr_level[lev], workest, 0, time, work_est_type, 0, 1, 0);
 
-        Real navg = static_cast<Real>(ba.size()) / static_cast<Real>(ParallelDescriptor::NProcs());
-        int nmax = std::max(std::round(loadbalance_max_fac*navg), std::ceil(navg));
-
-        newdm = DistributionMapping::makeKnapSack(workest, nmax);
+        newdm = DistributionMapping::makeKnapSack(workest, loadBalanceMaxBoxes(ba));
     }
     else
     {
-        newdm.define(ba);
+        newdm = makeDefaultDistributionMap(lev, ba);
     }
 
     return newdm;
 }
 
+DistributionMapping
+Amr::makeDefaultDistributionMap (int lev, const BoxArray& ba) const
+{
+#ifdef AMREX_USE_EB
+    if (loadbalance_with_eb_costs && EBHasLevel(Geom(lev)))
+    {
+        return EBMakeLoadBalanceDistributionMap(ba, Geom(lev), EBGetCellCosts(),
+                                                loadBalanceMaxBoxes(ba));
+    }
+#endif
+    return DistributionMapping(ba);
+}
+
+int
+Amr::loadBalanceMaxBoxes (const BoxArray& ba) const
+{
+    Real navg = static_cast<Real>(ba.size()) / static_cast<Real>(ParallelDescriptor::NProcs());
+    return std::max(std::round(loadbalance_max_fac*navg), std::ceil(navg));
+}
+
 void
 Amr::LoadBalanceLevel0 (Real time)
 {
@@ -4,6 +4,7 @@
 #include <unistd.h>
 #include <memory>
 #include <limits>
+#include <set>
 
 #include <AMReX_AmrLevel.H>
 #include <AMReX_Derive.H>
@@ -648,6 +649,24 @@ FillPatchIterator::FillPatchIterator (AmrLevel& amrlevel,
 #endif
 }
 
+FillPatchIterator::FillPatchIterator (AmrLevel&                 amrlevel,
+                                      MultiFab&                 leveldata,
+                                      int                       boxGrow,
+                                      Real                      time,
+                                      const Vector<StateRange>& states)
+    :
+    MFIter(leveldata),
+    m_amrlevel(amrlevel),
+    m_leveldata(leveldata),
+    m_ncomp(0)
+{
+    Initialize(boxGrow,time,states);
+
+#if BL_USE_TEAM
+    ParallelDescriptor::MyTeam().MemoryBarrier();
+#endif
+}
+
 static
 bool
 NeedToTouchUpPhysCorners (const Geometry& geom)
@@ -929,13 +948,86 @@ FillPatchIterator::Initialize (int  boxGrow,
 
     m_fabs.setDomainBndry(std::numeric_limits<Real>::quiet_NaN(), geom);
 
+    FillState(boxGrow, time, idx, scomp, 0, ncomp);
+    //
+    // Call hack to touch up fillPatched data.
+    //
+    m_amrlevel.set_preferred_boundary_values(m_fabs,
+                                             idx,
+                                             scomp,
+                                             0,
+                                             ncomp,
+                                             time);
+}
+
+void
+FillPatchIterator::Initialize (int                       boxGrow,
+                               Real                      time,
+                               const Vector<StateRange>& states)
+{
+    BL_PROFILE("FillPatchIterator::Initialize(states)");
+
+    m_comp_offset.resize(states.size());
+    m_ncomp = 0;
+    for (int i = 0, N = states.size(); i < N; ++i)
+    {
+        BL_ASSERT(states[i].scomp >= 0);
+        BL_ASSERT(states[i].ncomp >= 1);
+        BL_ASSERT(0 <= states[i].index && states[i].index < AmrLevel::desc_lst.size());
+        BL_ASSERT(AmrLevel::desc_lst[states[i].index].inRange(states[i].scomp,states[i].ncomp));
+
+        m_comp_offset[i] = m_ncomp;
+        m_ncomp += states[i].ncomp;
+    }
+
+    m_fabs.define(m_leveldata.boxArray(),m_leveldata.DistributionMap(),
+		  m_ncomp,boxGrow,MFInfo(),m_leveldata.Factory());
+
+    const Geometry& geom = m_amrlevel.Geom();
+
+    m_fabs.setDomainBndry(std::numeric_limits<Real>::quiet_NaN(), geom);
+
+    if (CanFuse(boxGrow, time, states))
+    {
+        FillFused(time, states);
+    }
+    else
+    {
+        for (int i = 0, N = states.size(); i < N; ++i) {
+            FillState(boxGrow, time, states[i].index, states[i].scomp,
+                      m_comp_offset[i], states[i].ncomp);
+        }
+    }
+
+    for (int i = 0, N = states.size(); i < N; ++i) {
+        m_amrlevel.set_preferred_boundary_values(m_fabs,
+                                                 states[i].index,
+                                                 states[i].scomp,
+                                                 m_comp_offset[i],
+                                                 states[i].ncomp,
+                                                 time);
+    }
+}
+
+void
+FillPatchIterator::FillState (int  boxGrow,
+                              Real time,
+                              int  idx,
+                              int  scomp,
+                              int  dcomp,
+                              int  ncomp)
+{
+    const StateDescriptor& desc = AmrLevel::desc_lst[idx];
+
+    const std::vector< std::pair<int,int> >& ranges = desc.sameInterps(scomp,ncomp);
+
     const IndexType& boxType = m_leveldata.boxArray().ixType();
     const int level = m_amrlevel.level;
 
-    for (int i = 0, DComp = 0; i < static_cast<int>(m_range.size()); i++)
+    for (int i = 0, DComp = dcomp; i < static_cast<int>(ranges.size()); i++)
     {
-        const int SComp = m_range[i].first;
-        const int NComp = m_range[i].second;
+        const int SComp = ranges[i].first;
+        const int NComp = ranges[i].second;
 
 	if (level == 0)
 	{
@@ -1006,15 +1098,174 @@ FillPatchIterator::Initialize (int  boxGrow,
 
         DComp += NComp;
     }
+}
+
+bool
+FillPatchIterator::CanFuse (int                       boxGrow,
+                            Real                      time,
+                            const Vector<StateRange>& states) const
+{
+    if (states.size() < 2) return false;
+
+    const int level = m_amrlevel.level;
+    const IndexType& boxType = m_fabs.boxArray().ixType();
+
+    // Each state has its own FillPatchPlans, which can only have one
+    // fill in flight.
+    std::set<int> indices;
+
+    for (const auto& s : states)
+    {
+        if (!indices.insert(s.index).second) return false;
+
+        // The fine data must be on the grids of m_fabs so that one
+        // FillBoundary fills the ghost cells of all of them.
+        Vector<MultiFab*> smf;
+        Vector<Real> stime;
+        m_amrlevel.state[s.index].getData(smf,stime,time);
+        if (smf.size() > 2 || smf[0]->getBDKey() != m_fabs.getBDKey()) return false;
+
+        if (level > 1)
+        {
+            const StateDescriptor& desc = AmrLevel::desc_lst[s.index];
+            for (const auto& r : desc.sameInterps(s.scomp,s.ncomp))
+            {
+                if (!amrex::ProperlyNested(m_amrlevel.crse_ratio,
+                                           m_amrlevel.parent->blockingFactor(level),
+                                           boxGrow, boxType, desc.interp(r.first))) {
+                    return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+void
+FillPatchIterator::FillFused (Real time, const Vector<StateRange>& states)
+{
+    BL_PROFILE("FillPatchIterator::FillFused");
+
+    const int level = m_amrlevel.level;
+    const Geometry& geom = m_amrlevel.geom;
+
     //
-    // Call hack to touch up fillPatched data.
+    // The valid cells of every state first, so that one exchange fills
+    // the ghost cells covered by the level for all of them.
     //
-    m_amrlevel.set_preferred_boundary_values(m_fabs,
-                                             idx,
-                                             scomp,
-                                             0,
-                                             ncomp,
-                                             time);
+    for (int i = 0, N = states.size(); i < N; ++i)
+    {
+        Vector<MultiFab*> smf;
+        Vector<Real> stime;
+        m_amrlevel.state[states[i].index].getData(smf,stime,time);
+
+        const int scomp = states[i].scomp;
+        const int dcomp = m_comp_offset[i];
+        const int ncomp = states[i].ncomp;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        for (MFIter mfi(m_fabs,true); mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mfi.tilebox();
+            FArrayBox& dfab = m_fabs[mfi];
+            if (smf.size() == 1) {
+                dfab.copy((*smf[0])[mfi], bx, scomp, bx, dcomp, ncomp);
+            } else {
+                dfab.linInterp((*smf[0])[mfi],scomp,(*smf[1])[mfi],scomp,
+                               stime[0],stime[1],time,bx,dcomp,ncomp);
+            }
+        }
+    }
+
+    if (level == 0)
+    {
+        m_fabs.FillBoundary(geom.periodicity());
+
+        for (int i = 0, N = states.size(); i < N; ++i)
+        {
+            StateData& statedata = m_amrlevel.state[states[i].index];
+            const StateDescriptor& desc = AmrLevel::desc_lst[states[i].index];
+            int DComp = m_comp_offset[i];
+            for (const auto& r : desc.sameInterps(states[i].scomp,states[i].ncomp))
+            {
+                StateDataPhysBCFunct physbcf(statedata,r.first,geom);
+                physbcf.FillBoundary(m_fabs, DComp, r.second, time, r.first);
+                DComp += r.second;
+            }
+        }
+        return;
+    }
+
+    m_fabs.FillBoundary_nowait(geom.periodicity());
+
+    //
+    // Post the coarse data of all states, and interpolate the patches
+    // whose coarse data are local while the messages are in flight.
+    //
+    AmrLevel& fine_level = m_amrlevel;
+    AmrLevel& crse_level = m_amrlevel.parent->getLevel(level-1);
+
+    const Geometry& geom_fine = fine_level.geom;
+    const Geometry& geom_crse = crse_level.geom;
+
+    struct Pending
+    {
+        FillPatchPlan* plan;
+        std::unique_ptr<StateDataPhysBCFunct> cbc;
+        std::unique_ptr<StateDataPhysBCFunct> fbc;
+    };
+    Vector<Pending> pending;
+
+    for (int i = 0, N = states.size(); i < N; ++i)
+    {
+        const int idx = states[i].index;
+        const StateDescriptor& desc = AmrLevel::desc_lst[idx];
+
+        StateData& statedata_crse = crse_level.state[idx];
+        StateData& statedata_fine = fine_level.state[idx];
+
+        Vector<MultiFab*> smf_crse, smf_fine;
+        Vector<Real> stime_crse, stime_fine;
+        statedata_crse.getData(smf_crse,stime_crse,time,states[i].scomp,states[i].ncomp);
+        statedata_fine.getData(smf_fine,stime_fine,time);
+
+        int DComp = m_comp_offset[i];
+        for (const auto& r : desc.sameInterps(states[i].scomp,states[i].ncomp))
+        {
+            const int SComp = r.first;
+            const int NComp = r.second;
+
+            Pending p;
+            p.plan = &fine_level.m_fillpatch_plans[{idx, SComp, NComp, m_fabs.nGrow()}];
+            p.cbc.reset(new StateDataPhysBCFunct(statedata_crse,SComp,geom_crse));
+            p.fbc.reset(new StateDataPhysBCFunct(statedata_fine,SComp,geom_fine));
+
+            amrex::FillPatchTwoLevels_nowait(*p.plan, m_fabs, time,
+                                             smf_crse, stime_crse,
+                                             smf_fine, stime_fine,
+                                             SComp, DComp, NComp,
+                                             geom_crse, geom_fine,
+                                             *p.cbc, SComp,
+                                             *p.fbc, SComp,
+                                             crse_level.fineRatio(),
+                                             desc.interp(SComp),
+                                             desc.getBCs(), SComp,
+                                             NullInterpHook(), NullInterpHook(),
+                                             false);
+
+            pending.push_back(std::move(p));
+            DComp += NComp;
+        }
+    }
+
+    m_fabs.FillBoundary_finish();
+
+    for (auto& p : pending) {
+        amrex::FillPatchTwoLevels_finish(*p.plan, *p.cbc, *p.fbc);
+    }
 }
 
 void
@@ -1052,7 +1303,7 @@ FillPatchIterator::FillFromTwoLevels (Real time, int idx, int scomp, int dcomp,
     Vector<MultiFab*> smf_crse;
     Vector<Real> stime_crse;
     StateData& statedata_crse = crse_level.state[idx];
-    statedata_crse.getData(smf_crse,stime_crse,time);
+    statedata_crse.getData(smf_crse,stime_crse,time,scomp,ncomp);
     StateDataPhysBCFunct physbcf_crse(statedata_crse,scomp,geom_crse);
 
     Vector<MultiFab*> smf_fine;
@@ -1063,7 +1314,9 @@ FillPatchIterator::FillFromTwoLevels (Real time, int idx, int scomp, int dcomp,
 
     const StateDescriptor& desc = AmrLevel::desc_lst[idx];
 
-    amrex::FillPatchTwoLevels(m_fabs, time, 
+    FillPatchPlan& plan = fine_level.m_fillpatch_plans[{idx, scomp, ncomp, m_fabs.nGrow()}];
+
+    amrex::FillPatchTwoLevels(plan, m_fabs, time,
                               smf_crse, stime_crse, 
                               smf_fine, stime_fine,
                               scomp, dcomp, ncomp, 
@@ -1520,7 +1773,7 @@ AmrLevel::FillCoarsePatch (MultiFab& mf,
 	    
 	    Vector<MultiFab*> smf;
 	    Vector<Real> stime;
-	    statedata.getData(smf,stime,time);
+	    statedata.getData(smf,stime,time,SComp,NComp);
 
 	    StateDataPhysBCFunct physbcf(statedata,SComp,cgeom);
 
@@ -2112,11 +2365,138 @@ AmrLevel::FillPatch (AmrLevel& amrlevel,
 {
     BL_ASSERT(dcomp+ncomp-1 <= leveldata.nComp());
     BL_ASSERT(boxGrow <= leveldata.nGrow());
+
+    //
+    // Filling new grids from an old level, as AmrLevel::init(old) does.
+    //
+    if (boxGrow == 0 && Amr::UsingIncrementalRegrid())
+    {
+        const MultiFab& S_old = amrlevel.get_new_data(index);
+        if (leveldata.boxArray().ixType() == S_old.boxArray().ixType() &&
+            (leveldata.boxArray() != S_old.boxArray() ||
+             leveldata.DistributionMap() != S_old.DistributionMap()) &&
+            FillPatchFromOld(amrlevel, leveldata, time, index, scomp, ncomp, dcomp))
+        {
+            return;
+        }
+    }
+
     FillPatchIterator fpi(amrlevel, leveldata, boxGrow, time, index, scomp, ncomp);
     const MultiFab& mf_fillpatched = fpi.get_mf();
     MultiFab::Copy(leveldata, mf_fillpatched, 0, dcomp, ncomp, boxGrow);
 }
 
+bool
+AmrLevel::FillPatchFromOld (AmrLevel& old,
+                            MultiFab& leveldata,
+                            Real      time,
+                            int       index,
+                            int       scomp,
+                            int       ncomp,
+                            int       dcomp)
+{
+    if (dynamic_cast<const DefaultFabFactory<FArrayBox>*>(&leveldata.Factory()) == nullptr) {
+        return false;
+    }
+
+    Vector<MultiFab*> smf;
+    Vector<Real> stime;
+    old.state[index].getData(smf,stime,time);
+    if (smf.size() != 1) return false;
+
+    BL_PROFILE("AmrLevel::FillPatchFromOld()");
+
+    const MultiFab& S_old = *smf[0];
+    const BoxArray& old_ba = S_old.boxArray();
+    const DistributionMapping& old_dm = S_old.DistributionMap();
+    const BoxArray& new_ba = leveldata.boxArray();
+    const DistributionMapping& new_dm = leveldata.DistributionMap();
+    //
+    // Each new box equal to an old box is either kept on its process or
+    // moved to another one.  The rest are FillPatched.
+    //
+    const int N = new_ba.size();
+    Vector<int> same(N,-1);
+    BoxList moved_bl(new_ba.ixType()), filled_bl(new_ba.ixType());
+    Vector<int> moved_idx, filled_idx, moved_pmap, filled_pmap;
+    long npts_kept = 0, npts_moved = 0, npts_filled = 0;
+
+    std::vector< std::pair<int,Box> > isects;
+    for (int i = 0; i < N; ++i)
+    {
+        const Box& bx = new_ba[i];
+        old_ba.intersections(bx,isects);
+        if (isects.size() == 1 && old_ba[isects[0].first] == bx)
+        {
+            same[i] = isects[0].first;
+            if (old_dm[same[i]] == new_dm[i]) {
+                npts_kept += bx.numPts();
+                continue;
+            }
+            moved_bl.push_back(bx);
+            moved_idx.push_back(i);
+            moved_pmap.push_back(new_dm[i]);
+            npts_moved += bx.numPts();
+        }
+        else
+        {
+            filled_bl.push_back(bx);
+            filled_idx.push_back(i);
+            filled_pmap.push_back(new_dm[i]);
+            npts_filled += bx.numPts();
+        }
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(leveldata); mfi.isValid(); ++mfi)
+    {
+        const int i = mfi.index();
+        if (same[i] >= 0 && old_dm[same[i]] == new_dm[i]) {
+            const Box& bx = new_ba[i];
+            leveldata[mfi].copy(S_old[same[i]], bx, scomp, bx, dcomp, ncomp);
+        }
+    }
+    //
+    // The subsets have the processors of the new boxes, so the results are
+    // copied back locally.
+    //
+    if (!moved_idx.empty())
+    {
+        MultiFab mf_moved(BoxArray(moved_bl), DistributionMapping(moved_pmap), ncomp, 0);
+        mf_moved.ParallelCopy(S_old, scomp, 0, ncomp);
+        for (MFIter mfi(mf_moved); mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mfi.validbox();
+            leveldata[moved_idx[mfi.index()]].copy(mf_moved[mfi], bx, 0, bx, dcomp, ncomp);
+        }
+    }
+
+    if (!filled_idx.empty())
+    {
+        MultiFab mf_filled(BoxArray(filled_bl), DistributionMapping(filled_pmap), ncomp, 0);
+        FillPatchIterator fpi(old, mf_filled, 0, time, index, scomp, ncomp);
+        const MultiFab& mf_fillpatched = fpi.get_mf();
+        for (MFIter mfi(mf_fillpatched); mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mfi.validbox();
+            leveldata[filled_idx[mfi.index()]].copy(mf_fillpatched[mfi], bx, 0, bx, dcomp, ncomp);
+        }
+    }
+
+    if (old.parent->Verbose() > 1)
+    {
+        const long nbytes = ncomp*sizeof(Real);
+        amrex::Print() << "AmrLevel::FillPatch: level " << old.level
+                       << " regrid kept " << npts_kept*nbytes
+                       << " bytes in place, moved " << npts_moved*nbytes
+                       << " bytes, FillPatched " << npts_filled*nbytes << " bytes\n";
+    }
+
+    return true;
+}
+
 void
 AmrLevel::FillPatchAdd (AmrLevel& amrlevel,
                         MultiFab& leveldata,
@@ -22,6 +22,7 @@ static constexpr int MFNEWDATA = 0;
 static constexpr int MFOLDDATA = 1;
 
 Vector<std::string> StateData::fabArrayHeaderNames;
+int StateData::interp_cache_size = 0;
 std::map<std::string, Vector<char> > *StateData::faHeaderMap;
 
 
@@ -59,6 +60,7 @@ StateData::StateData (StateData&& rhs) noexcept
 void
 StateData::operator= (StateData const& rhs)
 {
+    clearInterpCache();
     m_factory.reset(rhs.m_factory->clone());
     desc = rhs.desc;
     domain = rhs.domain;
@@ -86,6 +88,7 @@ StateData::define (const Box&             p_domain,
                    const FabFactory<FArrayBox>& factory)
 {
     BL_PROFILE("StateData::define()");
+    clearInterpCache();
     domain = p_domain;
     desc = &d;
     grids = grds;
@@ -122,6 +125,7 @@ StateData::define (const Box&             p_domain,
 void
 StateData::copyOld (const StateData& state)
 {
+    clearInterpCache();
     const MultiFab& MF = state.oldData();
     
     int nc = MF.nComp();
@@ -138,6 +142,7 @@ StateData::copyOld (const StateData& state)
 void
 StateData::copyNew (const StateData& state)
 {
+    clearInterpCache();
     const MultiFab& MF = state.newData();
 
     int nc = MF.nComp();
@@ -154,6 +159,7 @@ StateData::copyNew (const StateData& state)
 void
 StateData::reset ()
 {
+    clearInterpCache();
     new_time = old_time;
     old_time.start = old_time.stop = INVALID_TIME;
     std::swap(old_data, new_data);
@@ -197,6 +203,7 @@ void
 StateData::restartDoit (std::istream& is, const std::string& chkfile)
 {
     BL_PROFILE("StateData::restartDoit()");
+    clearInterpCache();
 
     is >> old_time.start;
     is >> old_time.stop;
@@ -265,6 +272,7 @@ void
 StateData::restart (const StateDescriptor& d,
 		    const StateData& rhs)
 {
+    clearInterpCache();
     desc = &d;
     domain = rhs.domain;
     grids = rhs.grids;
@@ -285,6 +293,7 @@ StateData::~StateData()
 void
 StateData::allocOldData ()
 {
+    clearInterpCache();
     if (old_data == nullptr)
     {
         old_data.reset(new MultiFab(grids,dmap,desc->nComp(),desc->nExtra(), MFInfo(), *m_factory));
@@ -302,6 +311,7 @@ StateData::getBC (int comp, int i) const
 void
 StateData::setOldTimeLevel (Real time)
 {
+    clearInterpCache();
     if (desc->timeType() == StateDescriptor::Point)
     {
         old_time.start = old_time.stop = time;
@@ -315,6 +325,7 @@ StateData::setOldTimeLevel (Real time)
 void
 StateData::setNewTimeLevel (Real time)
 {
+    clearInterpCache();
     if (desc->timeType() == StateDescriptor::Point)
     {
         new_time.start = new_time.stop = time;
@@ -328,6 +339,7 @@ StateData::setNewTimeLevel (Real time)
 void
 StateData::syncNewTimeLevel (Real time)
 {
+    clearInterpCache();
     Real teps = (new_time.stop - old_time.stop)*1.e-3;
     if (time > new_time.stop-teps && time < new_time.stop+teps)
     {
@@ -347,6 +359,7 @@ StateData::setTimeLevel (Real time,
                          Real dt_old,
                          Real dt_new)
 {
+    clearInterpCache();
     if (desc->timeType() == StateDescriptor::Point)
     {
         new_time.start = new_time.stop = time;
@@ -364,6 +377,7 @@ StateData::setTimeLevel (Real time,
 void
 StateData::swapTimeLevels (Real dt)
 {
+    clearInterpCache();
     old_time = new_time;
     if (desc->timeType() == StateDescriptor::Point)
     {
@@ -381,6 +395,7 @@ StateData::swapTimeLevels (Real dt)
 void
 StateData::replaceOldData (MultiFab&& mf)
 {
+    clearInterpCache();
     old_data.reset(new MultiFab(std::move(mf)));
 }
 
@@ -389,12 +404,15 @@ StateData::replaceOldData (MultiFab&& mf)
 void
 StateData::replaceOldData (StateData& s)
 {
+    clearInterpCache();
+    s.clearInterpCache();
     std::swap(old_data, s.old_data);
 }
 
 void
 StateData::replaceNewData (MultiFab&& mf)
 {
+    clearInterpCache();
     new_data.reset(new MultiFab(std::move(mf)));
 }
 
@@ -403,6 +421,8 @@ StateData::replaceNewData (MultiFab&& mf)
 void
 StateData::replaceNewData (StateData& s)
 {
+    clearInterpCache();
+    s.clearInterpCache();
     std::swap(new_data, s.new_data);
 }
 
@@ -739,6 +759,70 @@ StateData::getData (Vector<MultiFab*>& data,
     }
 }
 
+void
+StateData::getData (Vector<MultiFab*>& data,
+		    Vector<Real>& datatime,
+		    Real time,
+		    int  scomp,
+		    int  ncomp) const
+{
+    getData(data,datatime,time);
+
+    if (data.size() != 2 || interp_cache_size <= 0) return;
+
+    BL_PROFILE("StateData::getData(cache)");
+
+    BL_ASSERT(scomp >= 0 && scomp+ncomp <= desc->nComp());
+
+    auto it = std::find_if(interp_cache.begin(), interp_cache.end(),
+                           [=] (const InterpCacheEntry& e) { return e.time == time; });
+
+    if (it == interp_cache.end())
+    {
+        if (static_cast<int>(interp_cache.size()) >= interp_cache_size) {
+            interp_cache.erase(interp_cache.begin());
+        }
+        InterpCacheEntry e;
+        e.time = time;
+        e.data.reset(new MultiFab(grids,dmap,desc->nComp(),0,MFInfo(),*m_factory));
+        e.valid.resize(desc->nComp(),false);
+        interp_cache.push_back(std::move(e));
+        it = interp_cache.end()-1;
+    }
+
+    MultiFab& mf = *it->data;
+    const Real t0 = datatime[0];
+    const Real t1 = datatime[1];
+
+    for (int n = scomp; n < scomp+ncomp; )
+    {
+        if (it->valid[n]) { ++n; continue; }
+
+        // Interpolate the run of components that are not valid yet.
+        int nc = 1;
+        while (n+nc < scomp+ncomp && !it->valid[n+nc]) ++nc;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        for (MFIter mfi(mf,true); mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mfi.tilebox();
+            mf[mfi].linInterp((*old_data)[mfi],n,(*new_data)[mfi],n,t0,t1,time,bx,n,nc);
+        }
+
+        for (int i = n; i < n+nc; ++i) {
+            it->valid[i] = true;
+        }
+        n += nc;
+    }
+
+    data.clear();
+    datatime.clear();
+    data.push_back(&mf);
+    datatime.push_back(time);
+}
+
 void
 StateData::checkPoint (const std::string& name,
                        const std::string& fullpathname,
@@ -4,6 +4,7 @@
 #include <AMReX_AmrCore.H>
 #include <AMReX_ParmParse.H>
 #include <AMReX_Print.H>
+#include <AMReX_BLProfiler.H>
 
 #ifdef AMREX_PARTICLES
 #include <AMReX_AmrParGDB.H>
@@ -73,28 +74,46 @@ AmrCore::InitFromScratch (Real time)
 void
 AmrCore::regrid (int lbase, Real time, bool)
 {
+    BL_PROFILE("AmrCore::regrid()");
+
     int new_finest;
     Vector<BoxArray> new_grids(finest_level+2);
     MakeNewGrids(lbase, time, new_finest, new_grids);
 
     BL_ASSERT(new_finest <= finest_level+1);
 
+    if (NewGridsWithinTolerance(lbase, new_finest, new_grids)) {
+        if (verbose > 0) {
+            amrex::Print() << "Regridding at level lbase = " << lbase
+                           << " but new grids within regrid_tolerance\n";
+        }
+        return;
+    }
+
     for (int lev = lbase+1; lev <= new_finest; ++lev)
     {
 	if (lev <= finest_level) // an old level
 	{
 	    if (new_grids[lev] != grids[lev]) // otherwise nothing
 	    {
+                BL_PROFILE_VAR("AmrCore::regrid::distribution()", amrcore_dm);
 		DistributionMapping new_dmap(new_grids[lev]);
+                BL_PROFILE_VAR_STOP(amrcore_dm);
+                BL_PROFILE_VAR("AmrCore::regrid::data()", amrcore_data);
 		RemakeLevel(lev, time, new_grids[lev], new_dmap);
+                BL_PROFILE_VAR_STOP(amrcore_data);
 		SetBoxArray(lev, new_grids[lev]);
 		SetDistributionMap(lev, new_dmap);
 	    }
 	}
 	else  // a new level
 	{
+            BL_PROFILE_VAR("AmrCore::regrid::distribution()", amrcore_dm);
 	    DistributionMapping new_dmap(new_grids[lev]);
+            BL_PROFILE_VAR_STOP(amrcore_dm);
+            BL_PROFILE_VAR("AmrCore::regrid::data()", amrcore_data);
 	    MakeNewLevelFromCoarse(lev, time, new_grids[lev], new_dmap);
+            BL_PROFILE_VAR_STOP(amrcore_data);
 	    SetBoxArray(lev, new_grids[lev]);
 	    SetDistributionMap(lev, new_dmap);
 	}
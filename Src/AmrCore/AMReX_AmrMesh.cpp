@@ -5,12 +5,34 @@
 #include <AMReX_ParmParse.H>
 #include <AMReX_ParallelDescriptor.H>
 #include <AMReX_Print.H>
+#include <AMReX_BLProfiler.H>
+
+#include <cstring>
 
 namespace amrex {
 
 namespace
 {
     bool initialized = false;
+
+    //
+    // FNV-1a style hash of n ints, for the tag fingerprints.
+    //
+    void
+    HashInts (std::uint64_t& h, const int* p, long n)
+    {
+        for (long i = 0; i < n; ++i) {
+            h ^= static_cast<std::uint32_t>(p[i]);
+            h *= 1099511628211ULL;
+        }
+    }
+
+    void
+    HashBox (std::uint64_t& h, const Box& bx)
+    {
+        HashInts(h, bx.loVect(), AMREX_SPACEDIM);
+        HashInts(h, bx.hiVect(), AMREX_SPACEDIM);
+    }
 }
 
 void
@@ -64,6 +86,8 @@ AmrMesh::InitAmrMesh (int max_level_in, const Vector<int>& n_cell_in, std::vecto
 
     use_new_chop         = false;
     iterate_on_new_grids = true;
+    reuse_clusters       = false;
+    regrid_tolerance     = 0.0;
 
     ParmParse pp("amr");
 
@@ -85,6 +109,9 @@ AmrMesh::InitAmrMesh (int max_level_in, const Vector<int>& n_cell_in, std::vecto
     dmap.resize(nlev);
     grids.resize(nlev);
 
+    tag_fingerprint.resize(max_level, 0);
+    tag_grids.resize(max_level);
+
     for (int i = 0; i < nlev; ++i) {
 	n_error_buf[i] = 1;
         blocking_factor[i] = IntVect{AMREX_D_DECL(8,8,8)};
@@ -102,6 +129,8 @@ AmrMesh::InitAmrMesh (int max_level_in, const Vector<int>& n_cell_in, std::vecto
 
     pp.query("n_proper",n_proper);
     pp.query("grid_eff",grid_eff);
+    pp.query("reuse_clusters",reuse_clusters);
+    pp.query("regrid_tolerance",regrid_tolerance);
     int cnt = pp.countval("n_error_buf");
     if (cnt > 0) {
         pp.getarr("n_error_buf",n_error_buf);
@@ -505,7 +534,9 @@ AmrMesh::MakeNewGrids (int lbase, Real time, int& new_finest, Vector<BoxArray>&
         //
 
         if ( ! (useFixedCoarseGrids() && levc < useFixedUpToLevel()) ) {
+            BL_PROFILE_VAR("AmrMesh::MakeNewGrids::ErrorEst()", amrmesh_errorest);
 	    ErrorEst(levc, tags, time, ngrow);
+            BL_PROFILE_VAR_STOP(amrmesh_errorest);
 	}
 
         //
@@ -623,9 +654,11 @@ AmrMesh::MakeNewGrids (int lbase, Real time, int& new_finest, Vector<BoxArray>&
         //
         // Create initial cluster containing all tagged points.
         //
+        BL_PROFILE_VAR("AmrMesh::MakeNewGrids::collate()", amrmesh_collate);
 	Vector<IntVect> tagvec;
 	tags.collate(tagvec);
         tags.clear();
+        BL_PROFILE_VAR_STOP(amrmesh_collate);
 
         if (tagvec.size() > 0)
         {
@@ -636,6 +669,43 @@ AmrMesh::MakeNewGrids (int lbase, Real time, int& new_finest, Vector<BoxArray>&
                 new_finest = std::max(new_finest,levf);
 	    }
             //
+            // The grids depend only on the (sorted) coarsened tags, the
+            // proper nesting domain and the gridding parameters.  If none of
+            // them changed since the last time, reuse the last grids.
+            //
+            std::uint64_t fingerprint = 0;
+            if (reuse_clusters)
+            {
+                fingerprint = 14695981039346656037ULL;
+                HashInts(fingerprint, tagvec[0].getVect(), tagvec.size()*AMREX_SPACEDIM);
+                for (const Box& bx : p_n[levc]) {
+                    HashBox(fingerprint, bx);
+                }
+                HashBox(fingerprint, Geom(levf).Domain());
+                HashInts(fingerprint, bf_lev[levc].getVect(), AMREX_SPACEDIM);
+                HashInts(fingerprint, ref_ratio[levc].getVect(), AMREX_SPACEDIM);
+                HashInts(fingerprint, max_grid_size[levf].getVect(), AMREX_SPACEDIM);
+                int eff_bits[sizeof(Real)/sizeof(int)];
+                std::memcpy(eff_bits, &grid_eff, sizeof(Real));
+                HashInts(fingerprint, eff_bits, sizeof(Real)/sizeof(int));
+                const int chop_type = use_new_chop;
+                HashInts(fingerprint, &chop_type, 1);
+
+                if (fingerprint == tag_fingerprint[levc] && !tag_grids[levc].isEmpty())
+                {
+                    if (verbose > 0) {
+                        amrex::Print() << "MakeNewGrids: tags at level " << levc
+                                       << " unchanged, reusing the grids of level " << levf << "\n";
+                    }
+                    if(levf > useFixedUpToLevel()) {
+                        new_grids[levf].define(tag_grids[levc]);
+                    }
+                    continue;
+                }
+            }
+
+            BL_PROFILE_VAR("AmrMesh::MakeNewGrids::cluster()", amrmesh_cluster);
+            //
             // Construct initial cluster.
             //
             ClusterList clist(&tagvec[0], tagvec.size());
@@ -684,6 +754,13 @@ AmrMesh::MakeNewGrids (int lbase, Real time, int& new_finest, Vector<BoxArray>&
 		    new_bx = amrex::intersect(new_bx,Geom(levf).Domain());
 		}
 	    }
+            BL_PROFILE_VAR_STOP(amrmesh_cluster);
+
+            if (reuse_clusters)
+            {
+                tag_fingerprint[levc] = fingerprint;
+                tag_grids[levc] = new_bx;
+            }
 
             if(levf > useFixedUpToLevel()) {
               new_grids[levf].define(new_bx);
@@ -708,6 +785,34 @@ AmrMesh::MakeNewGrids (int lbase, Real time, int& new_finest, Vector<BoxArray>&
     }
 }
 
+bool
+AmrMesh::NewGridsWithinTolerance (int lbase, int new_finest, const Vector<BoxArray>& new_grids) const
+{
+    if (regrid_tolerance <= 0.0 || new_finest != finest_level) return false;
+
+    for (int lev = lbase+1; lev <= new_finest; ++lev)
+    {
+        const BoxArray& ba  = grids[lev];
+        const BoxArray& nba = new_grids[lev];
+        if (nba == ba) continue;
+        if (nba.empty() || ba.empty()) return false;
+
+        long ncommon = 0;
+        std::vector< std::pair<int,Box> > isects;
+        for (int i = 0, N = nba.size(); i < N; ++i)
+        {
+            ba.intersections(nba[i],isects);
+            for (const auto& is : isects) {
+                ncommon += is.second.numPts();
+            }
+        }
+        const long ndiff = ba.numPts() + nba.numPts() - 2*ncommon;
+        if (ndiff > regrid_tolerance*ba.numPts()) return false;
+    }
+
+    return true;
+}
+
 void
 AmrMesh::MakeNewGrids (Real time)
 {
@@ -2,11 +2,139 @@
 #include <algorithm>
 #include <AMReX_Cluster.H>
 #include <AMReX_BoxDomain.H>
+#include <AMReX_BLProfiler.H>
+#include <AMReX_Utility.H>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 namespace amrex {
 
 namespace {
 enum CutStatus { HoleCut=0, SteepCut, BisectCut, InvalidCut };
+
+//
+// Work on a cluster with at least this many points is shared by the
+// threads, unless we are already in a parallel region.
+//
+const long min_threaded_len = 100000;
+
+bool
+threaded (long len)
+{
+#ifdef _OPENMP
+    return len >= min_threaded_len && omp_get_max_threads() > 1 && !omp_in_parallel();
+#else
+    amrex::ignore_unused(len);
+    return false;
+#endif
+}
+
+//
+// Count the points in each plane of bx, in each index direction.
+//
+void
+Histogram (const IntVect* ar,
+           long           len,
+           const Box&     bx,
+           Vector<int>    (&hist)[AMREX_SPACEDIM])
+{
+    const int* lo = bx.loVect();
+
+    for (int n = 0; n < AMREX_SPACEDIM; n++)
+        hist[n].assign(bx.length(n), 0);
+
+    if (threaded(len))
+    {
+#ifdef _OPENMP
+#pragma omp parallel
+        {
+            Vector<int> thist[AMREX_SPACEDIM];
+            for (int n = 0; n < AMREX_SPACEDIM; n++)
+                thist[n].assign(bx.length(n), 0);
+#pragma omp for
+            for (long i = 0; i < len; i++)
+            {
+                const int* p = ar[i].getVect();
+                AMREX_D_TERM( thist[0][p[0]-lo[0]]++;,
+                              thist[1][p[1]-lo[1]]++;,
+                              thist[2][p[2]-lo[2]]++; )
+            }
+#pragma omp critical(cluster_histogram)
+            for (int n = 0; n < AMREX_SPACEDIM; n++)
+                for (int i = 0, N = thist[n].size(); i < N; i++)
+                    hist[n][i] += thist[n][i];
+        }
+#endif
+    }
+    else
+    {
+        for (long i = 0; i < len; i++)
+        {
+            const int* p = ar[i].getVect();
+            AMREX_D_TERM( hist[0][p[0]-lo[0]]++;,
+                          hist[1][p[1]-lo[1]]++;,
+                          hist[2][p[2]-lo[2]]++; )
+        }
+    }
+}
+
+//
+// Like std::partition, but shared by the threads for long arrays.  The
+// order of the points on either side may differ, which does not change
+// the clusters.
+//
+template <class Pred>
+IntVect*
+Partition (IntVect*    ar,
+           long        len,
+           const Pred& pred)
+{
+    if (!threaded(len))
+        return std::partition(ar, ar+len, pred);
+
+#ifdef _OPENMP
+    const Vector<IntVect> src(ar, ar+len);
+    const int nthreads = omp_get_max_threads();
+    Vector<long> nlo(nthreads+1, 0), nhi(nthreads+1, 0);
+    long tot_lo = 0;
+#pragma omp parallel
+    {
+        const int nt  = omp_get_num_threads();
+        const int tid = omp_get_thread_num();
+        const long b  = len*tid/nt;
+        const long e  = len*(tid+1)/nt;
+        long cnt = 0;
+        for (long i = b; i < e; i++)
+            if (pred(src[i])) cnt++;
+        nlo[tid+1] = cnt;
+        nhi[tid+1] = (e-b) - cnt;
+#pragma omp barrier
+#pragma omp single
+        {
+            for (int t = 0; t < nt; t++)
+            {
+                nlo[t+1] += nlo[t];
+                nhi[t+1] += nhi[t];
+            }
+            tot_lo = nlo[nt];
+        }
+        long ilo = nlo[tid];
+        long ihi = tot_lo + nhi[tid];
+        for (long i = b; i < e; i++)
+        {
+            if (pred(src[i]))
+                ar[ilo++] = src[i];
+            else
+                ar[ihi++] = src[i];
+        }
+    }
+    return ar + tot_lo;
+#else
+    return std::partition(ar, ar+len, pred);
+#endif
+}
 }
 
 Cluster::Cluster ()
@@ -61,7 +189,7 @@ Cluster::Cluster (Cluster&   c,
     }
     else
     {
-        IntVect* prt_it = std::partition(c.m_ar, c.m_ar+c.m_len, InBox(b));
+        IntVect* prt_it = Partition(c.m_ar, c.m_len, InBox(b));
 
         if (prt_it == c.m_ar)
         {
@@ -139,10 +267,33 @@ Cluster::minBox ()
     else
     {
         IntVect lo = m_ar[0], hi = lo;
-        for (int i = 1; i < m_len; i++)
+        if (threaded(m_len))
         {
-            lo.min(m_ar[i]);
-            hi.max(m_ar[i]);
+#ifdef _OPENMP
+#pragma omp parallel
+            {
+                IntVect tlo = lo, thi = hi;
+#pragma omp for
+                for (long i = 1; i < m_len; i++)
+                {
+                    tlo.min(m_ar[i]);
+                    thi.max(m_ar[i]);
+                }
+#pragma omp critical(cluster_minbox)
+                {
+                    lo.min(tlo);
+                    hi.max(thi);
+                }
+            }
+#endif
+        }
+        else
+        {
+            for (long i = 1; i < m_len; i++)
+            {
+                lo.min(m_ar[i]);
+                hi.max(m_ar[i]);
+            }
         }
         m_bx = Box(lo,hi);
     }
@@ -262,25 +413,11 @@ Cluster::chop ()
 
     const int* lo       = m_bx.loVect();
     const int* hi       = m_bx.hiVect();
-    IntVect m_bx_length = m_bx.size();
-    const int* len      = m_bx_length.getVect();
     //
     // Compute histogram.
     //
-    int* hist[AMREX_SPACEDIM];
-    for (int n = 0; n < AMREX_SPACEDIM; n++)
-    {
-        hist[n] = new int[len[n]];
-        for (int i = 0; i < len[n]; i++)
-            hist[n][i] = 0;
-    }
-    for (int n = 0; n < m_len; n++)
-    {
-        const int* p = m_ar[n].getVect();
-        AMREX_D_TERM( hist[0][p[0]-lo[0]]++;,
-                hist[1][p[1]-lo[1]]++;,
-                hist[2][p[2]-lo[2]]++; )
-     }
+    Vector<int> hist[AMREX_SPACEDIM];
+    Histogram(m_ar, m_len, m_bx, hist);
     //
     // Find cutpoint and cutstatus in each index direction.
     //
@@ -289,7 +426,7 @@ Cluster::chop ()
     IntVect cut;
     for (int n = 0; n < AMREX_SPACEDIM; n++)
     {
-        cut[n] = FindCut(hist[n], lo[n], hi[n], status[n]);
+        cut[n] = FindCut(hist[n].dataPtr(), lo[n], hi[n], status[n]);
         if (status[n] < mincut)
         {
             mincut = status[n];
@@ -322,10 +459,7 @@ Cluster::chop ()
 
     int nhi = m_len - nlo;
 
-    for (int i = 0; i < AMREX_SPACEDIM; i++)
-        delete [] hist[i];
-
-    IntVect* prt_it = std::partition(m_ar, m_ar+m_len, Cut(cut,dir));
+    IntVect* prt_it = Partition(m_ar, m_len, Cut(cut,dir));
 
     BL_ASSERT((prt_it-m_ar) == nlo);
     BL_ASSERT(((m_ar+m_len)-prt_it) == nhi);
@@ -344,25 +478,11 @@ Cluster::new_chop ()
 
     const int* lo       = m_bx.loVect();
     const int* hi       = m_bx.hiVect();
-    IntVect m_bx_length = m_bx.size();
-    const int* len      = m_bx_length.getVect();
     //
     // Compute histogram.
     //
-    int* hist[AMREX_SPACEDIM];
-    for (int n = 0; n < AMREX_SPACEDIM; n++)
-    {
-        hist[n] = new int[len[n]];
-        for (int i = 0; i < len[n]; i++)
-            hist[n][i] = 0;
-    }
-    for (int n = 0; n < m_len; n++)
-    {
-        const int* p = m_ar[n].getVect();
-        AMREX_D_TERM( hist[0][p[0]-lo[0]]++;,
-             hist[1][p[1]-lo[1]]++;,
-             hist[2][p[2]-lo[2]]++; )
-   }
+    Vector<int> hist[AMREX_SPACEDIM];
+    Histogram(m_ar, m_len, m_bx, hist);
 
     int invalid_dir = -1;
     for (int n_try = 0; n_try < 2; n_try++)
@@ -377,7 +497,7 @@ Cluster::new_chop ()
        {
            if (n != invalid_dir)
            {
-              cut[n] = FindCut(hist[n], lo[n], hi[n], status[n]);
+              cut[n] = FindCut(hist[n].dataPtr(), lo[n], hi[n], status[n]);
               if (status[n] < mincut)
               {
                   mincut = status[n];
@@ -411,7 +531,7 @@ Cluster::new_chop ()
 
        int nhi = m_len - nlo;
 
-       IntVect* prt_it = std::partition(m_ar, m_ar+m_len, Cut(cut,dir));
+       IntVect* prt_it = Partition(m_ar, m_len, Cut(cut,dir));
 
        BL_ASSERT((prt_it-m_ar) == nlo);
        BL_ASSERT(((m_ar+m_len)-prt_it) == nhi);
@@ -430,9 +550,6 @@ Cluster::new_chop ()
    
        if ( (eff() > oldeff) || (neweff > oldeff) || n_try > 0)
        {
-          for (int i = 0; i < AMREX_SPACEDIM; i++)
-              delete [] hist[i];
-
           return newbox.release();
 
        } else {
@@ -533,34 +650,81 @@ ClusterList::boxList (BoxList& blst) const
 void
 ClusterList::chop (Real eff)
 {
-
-    for (std::list<Cluster*>::iterator cli = lst.begin(); cli != lst.end(); )
-    {
-        if ((*cli)->eff() < eff)
-        {
-            lst.push_back((*cli)->chop());
-        }
-        else
-        {
-            ++cli;
-        }
-    }
+    chop(eff, false);
 }
 
 void
 ClusterList::new_chop (Real eff)
 {
+    chop(eff, true);
+}
 
-    for (std::list<Cluster*>::iterator cli = lst.begin(); cli != lst.end(); )
+void
+ClusterList::chop (Real eff, bool use_new_chop)
+{
+    BL_PROFILE("ClusterList::chop()");
+    //
+    // Each cluster is chopped until it is efficient enough.  The lower
+    // part of a cut stays in the cluster, and the upper part is a new
+    // piece of it, which is chopped in turn.  Clusters are independent,
+    // so the threads chop different clusters.  At the end the list is put
+    // in the order of chopping one cluster at a time, with the pieces
+    // appended in the order they were made.
+    //
+    struct Node
+    {
+        Cluster*    c;
+        Vector<int> pieces;
+    };
+    Vector<Node> nodes;
+    Vector<int>  todo;
+
+    for (std::list<Cluster*>::iterator cli = lst.begin(); cli != lst.end(); ++cli)
+    {
+        todo.push_back(nodes.size());
+        nodes.push_back({*cli, Vector<int>()});
+    }
+    const int nlst = nodes.size();
+
+    while (!todo.empty())
     {
-        if ((*cli)->eff() < eff)
+        const int ntodo = todo.size();
+        Vector<Vector<Cluster*> > pieces(ntodo);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (ntodo >= omp_get_max_threads())
+#endif
+        for (int i = 0; i < ntodo; i++)
         {
-            lst.push_back((*cli)->new_chop());
+            Cluster* c = nodes[todo[i]].c;
+            while (c->eff() < eff)
+            {
+                pieces[i].push_back(use_new_chop ? c->new_chop() : c->chop());
+            }
         }
-        else
+
+        Vector<int> next;
+        for (int i = 0; i < ntodo; i++)
         {
-            ++cli;
+            for (Cluster* p : pieces[i])
+            {
+                nodes[todo[i]].pieces.push_back(nodes.size());
+                next.push_back(nodes.size());
+                nodes.push_back({p, Vector<int>()});
+            }
         }
+        todo.swap(next);
+    }
+
+    Vector<int> order(nlst);
+    for (int i = 0; i < nlst; i++)
+        order[i] = i;
+
+    lst.clear();
+    for (int i = 0; i < static_cast<int>(order.size()); i++)
+    {
+        const Node& node = nodes[order[i]];
+        lst.push_back(node.c);
+        order.insert(order.end(), node.pieces.begin(), node.pieces.end());
     }
 }
 
@@ -200,6 +200,572 @@ namespace amrex
 	FillPatchSingleLevel(mf, time, fmf, ft, scomp, dcomp, ncomp, fgeom, fbc, fbccomp);
     }
 
+    bool FillPatchPlan::isValid (const MultiFab& mf, const MultiFab& fmf, const Geometry& fgeom,
+                                 const IntVect& ratio, const Interpolater* mapper) const
+    {
+        // The plan stores copies of the destination and fine BoxArrays and
+        // DistributionMappings.  They are compared by value: a shared
+        // reference matches at once, otherwise the boxes and the processor
+        // maps are compared element by element.  A regrid that reproduces
+        // the same layout therefore keeps the plan.  The interpolater is
+        // compared by address.  The coarse layout is not checked here: the
+        // synchronous fill copies into the patches with a ParallelCopy on
+        // every call, and the asynchronous fill checks it separately.
+        return m_ngrow == mf.nGrow()
+            && m_mapper == mapper
+            && m_ratio == ratio
+            && m_fdomain == amrex::convert(fgeom.Domain(), mf.boxArray().ixType())
+            && m_dst_ba == mf.boxArray()
+            && m_dst_dm == mf.DistributionMap()
+            && m_src_ba == fmf.boxArray()
+            && m_src_dm == fmf.DistributionMap();
+    }
+
+    void FillPatchPlan::define (const MultiFab& mf, const MultiFab& fmf,
+                                const Geometry& cgeom, const Geometry& fgeom,
+                                const IntVect& ratio, Interpolater* mapper)
+    {
+        BL_PROFILE("FillPatchPlan::define()");
+
+        clear();
+
+        m_dst_ba = mf.boxArray();
+        m_dst_dm = mf.DistributionMap();
+        m_src_ba = fmf.boxArray();
+        m_src_dm = fmf.DistributionMap();
+        m_ngrow  = mf.nGrow();
+        m_ratio  = ratio;
+        m_mapper = mapper;
+
+        m_fdomain = amrex::convert(fgeom.Domain(), mf.boxArray().ixType());
+        Box fdomain_g(m_fdomain);
+        for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+            if (fgeom.isPeriodic(i)) {
+                fdomain_g.grow(i,m_ngrow);
+            }
+        }
+
+        const InterpolaterBoxCoarsener& coarsener = mapper->BoxCoarsener(ratio);
+        const FabArrayBase::FPinfo& fpc = FabArrayBase::TheFPinfo(fmf, mf, fdomain_g,
+                                                                  IntVect(m_ngrow),
+                                                                  coarsener,
+                                                                  amrex::coarsen(fgeom.Domain(),ratio));
+
+        ba_crse_patch = fpc.ba_crse_patch;
+        dm_crse_patch = fpc.dm_crse_patch;
+        dst_idxs      = fpc.dst_idxs;
+        dst_boxes     = fpc.dst_boxes;
+        if (fpc.fact_crse_patch) {
+            m_fact_crse_patch.reset(fpc.fact_crse_patch->clone());
+        }
+    }
+
+    void FillPatchPlan::clear ()
+    {
+        BL_ASSERT(!isPending());
+        ba_crse_patch = BoxArray();
+        dm_crse_patch = DistributionMapping();
+        dst_idxs.clear();
+        dst_boxes.clear();
+        m_dst_ba = BoxArray();
+        m_dst_dm = DistributionMapping();
+        m_src_ba = BoxArray();
+        m_src_dm = DistributionMapping();
+        m_ngrow = -1;
+        m_mapper = nullptr;
+        m_fact_crse_patch.reset();
+        m_crse_patch[0].reset();
+        m_crse_patch[1].reset();
+        m_bcs.clear();
+        m_patch_bcs.clear();
+        for (auto& ps : m_async_patches) {
+            ps = PatchSet();
+        }
+        m_crse_ba = BoxArray();
+        m_crse_dm = DistributionMapping();
+        m_async_dst.clear();
+    }
+
+    void FillPatchPlan::defineAsync (const MultiFab& cmf, const MultiFab& fmf,
+                                     const Geometry& cgeom, const Geometry& fgeom)
+    {
+        BL_PROFILE("FillPatchPlan::defineAsync()");
+
+        for (auto& ps : m_async_patches) {
+            ps = PatchSet();
+        }
+        m_crse_ba = cmf.boxArray();
+        m_crse_dm = cmf.DistributionMap();
+        m_async_dst.clear();
+
+        if (ba_crse_patch.empty()) return;
+
+        const int myproc = ParallelDescriptor::MyProc();
+        const std::vector<IntVect>& cshifts = cgeom.periodicity().shiftIntVect();
+        std::vector<std::pair<int,Box> > isects;
+
+        // A patch goes into set 1 if any of its coarse data live on
+        // another process.
+        BoxList bl[2] = { BoxList(ba_crse_patch.ixType()), BoxList(ba_crse_patch.ixType()) };
+        Vector<int> iprocs[2];
+        for (int i = 0, li = 0, N = ba_crse_patch.size(); i < N; ++i)
+        {
+            const Box& bx = ba_crse_patch[i];
+            const int iproc = dm_crse_patch[i];
+            int iset = 0;
+            for (const auto& iv : cshifts)
+            {
+                m_crse_ba.intersections(bx+iv, isects);
+                for (const auto& is : isects) {
+                    if (m_crse_dm[is.first] != iproc) iset = 1;
+                }
+            }
+            bl[iset].push_back(bx);
+            iprocs[iset].push_back(iproc);
+            if (iproc == myproc) {
+                m_async_patches[iset].li.push_back(li++);
+            }
+        }
+
+        for (int iset = 0; iset < 2; ++iset)
+        {
+            PatchSet& ps = m_async_patches[iset];
+            if (iprocs[iset].empty()) continue;
+            ps.ba.define(bl[iset]);
+            ps.dm.define(std::move(iprocs[iset]));
+#ifdef AMREX_USE_EB
+            ps.fact = makeEBFabFactory(cgeom, ps.ba, ps.dm, {0,0,0}, EBSupport::basic);
+#else
+            ps.fact.reset(new FArrayBoxFactory());
+#endif
+        }
+
+        // The fine-level exchange writes the periodic images of the fine
+        // level after the patches have been interpolated, so those cells
+        // are left out to keep the two disjoint.
+        const std::vector<IntVect>& fshifts = fgeom.periodicity().shiftIntVect();
+        m_async_dst.resize(dst_boxes.size());
+        for (int li = 0, N = dst_boxes.size(); li < N; ++li)
+        {
+            const Box& dbx = dst_boxes[li];
+            BoxList covered(dbx.ixType());
+            for (const auto& iv : fshifts)
+            {
+                if (iv == IntVect::TheZeroVector()) continue;
+                fmf.boxArray().intersections(dbx+iv, isects);
+                for (const auto& is : isects) {
+                    covered.push_back(is.second-iv);
+                }
+            }
+            if (covered.isEmpty()) {
+                m_async_dst[li] = BoxList(dbx);
+            } else {
+                m_async_dst[li] = amrex::complementIn(dbx, covered);
+            }
+        }
+    }
+
+    MultiFab& FillPatchPlan::asyncPatch (int iset, int i, int ncomp)
+    {
+        PatchSet& ps = m_async_patches[iset];
+        auto& mf = ps.mf[i];
+        if (mf == nullptr || mf->nComp() < ncomp) {
+            mf.reset(new MultiFab(ps.ba, ps.dm, ncomp, 0, MFInfo(), *ps.fact));
+        }
+        return *mf;
+    }
+
+    void FillPatchPlan::interpAsyncPatches (int iset, PhysBCFunctBase& cbc,
+                                            const InterpHook& pre_interp,
+                                            const InterpHook& post_interp)
+    {
+        PatchSet& ps = m_async_patches[iset];
+        const Pending& p = m_pending;
+        if (!p.crse || ps.ba.empty()) return;
+
+        const int ncomp = p.ncomp;
+        const int dcomp = p.dcomp;
+        MultiFab& mf_crse_patch = *ps.mf[0];
+
+        if (p.ct.size() == 2)
+        {
+            MultiFab& mf_crse_patch_1 = *ps.mf[1];
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+            for (MFIter mfi(mf_crse_patch,true); mfi.isValid(); ++mfi)
+            {
+                const Box& bx = mfi.tilebox();
+                mf_crse_patch[mfi].linInterp(mf_crse_patch[mfi], 0, mf_crse_patch_1[mfi], 0,
+                                             p.ct[0], p.ct[1], p.time, bx, 0, ncomp);
+            }
+        }
+
+        cbc.FillBoundary(mf_crse_patch, 0, ncomp, p.time, p.cbccomp);
+
+        int idummy1=0, idummy2=0;
+        bool cc = ps.ba.ixType().cellCentered();
+        ignore_unused(cc);
+#ifdef _OPENMP
+#pragma omp parallel if (cc)
+#endif
+        {
+            Vector<BCRec> bcr(ncomp);
+            for (MFIter mfi(mf_crse_patch); mfi.isValid(); ++mfi)
+            {
+                FArrayBox& sfab = mf_crse_patch[mfi];
+                int li = ps.li[mfi.LocalIndex()];
+                int gi = dst_idxs[li];
+                FArrayBox& dfab = (*p.mf)[gi];
+
+                std::copy(m_patch_bcs.begin()+li*ncomp, m_patch_bcs.begin()+(li+1)*ncomp,
+                          bcr.begin());
+
+                pre_interp(sfab, sfab.box(), 0, ncomp);
+
+                for (const Box& dbx : m_async_dst[li])
+                {
+                    p.mapper->interp(sfab,
+                                     0,
+                                     dfab,
+                                     dcomp,
+                                     ncomp,
+                                     dbx,
+                                     p.ratio,
+                                     p.cgeom,
+                                     p.fgeom,
+                                     bcr,
+                                     idummy1, idummy2);
+
+                    post_interp(dfab, dbx, dcomp, ncomp);
+                }
+            }
+        }
+    }
+
+    MultiFab& FillPatchPlan::crsePatch (int i, int ncomp)
+    {
+        auto& mf = m_crse_patch[i];
+        if (mf == nullptr || mf->nComp() < ncomp) {
+            mf.reset(new MultiFab(ba_crse_patch, dm_crse_patch, ncomp, 0, MFInfo(),
+                                  *m_fact_crse_patch));
+        }
+        return *mf;
+    }
+
+    const Vector<BCRec>& FillPatchPlan::patchBCs (const Vector<BCRec>& bcs, int bcscomp, int ncomp)
+    {
+        Vector<BCRec> key(bcs.begin()+bcscomp, bcs.begin()+bcscomp+ncomp);
+        if (key != m_bcs)
+        {
+            const int npatch = dst_boxes.size();
+            m_patch_bcs.resize(npatch*ncomp);
+            Vector<BCRec> bcr(ncomp);
+            for (int li = 0; li < npatch; ++li) {
+                amrex::setBC(dst_boxes[li], m_fdomain, bcscomp, 0, ncomp, bcs, bcr);
+                std::copy(bcr.begin(), bcr.end(), m_patch_bcs.begin()+li*ncomp);
+            }
+            m_bcs = std::move(key);
+        }
+        return m_patch_bcs;
+    }
+
+    long FillPatchPlan::bytes () const
+    {
+        long cnt = sizeof(FillPatchPlan);
+        cnt += sizeof(Box) * (ba_crse_patch.capacity() + dst_boxes.capacity());
+        cnt += sizeof(int) * (dm_crse_patch.capacity() + dst_idxs.capacity());
+        cnt += sizeof(BCRec) * (m_bcs.capacity() + m_patch_bcs.capacity());
+        for (const auto& mf : m_crse_patch) {
+            if (mf) {
+                for (MFIter mfi(*mf); mfi.isValid(); ++mfi) {
+                    cnt += (*mf)[mfi].nBytes();
+                }
+            }
+        }
+        for (const auto& ps : m_async_patches) {
+            cnt += sizeof(Box) * ps.ba.capacity();
+            cnt += sizeof(int) * (ps.dm.capacity() + ps.li.capacity());
+            for (const auto& mf : ps.mf) {
+                if (mf) {
+                    for (MFIter mfi(*mf); mfi.isValid(); ++mfi) {
+                        cnt += (*mf)[mfi].nBytes();
+                    }
+                }
+            }
+        }
+        for (const auto& bl : m_async_dst) {
+            cnt += sizeof(Box) * bl.capacity();
+        }
+        return cnt;
+    }
+
+    void FillPatchTwoLevels (FillPatchPlan& plan, MultiFab& mf, Real time,
+			     const Vector<MultiFab*>& cmf, const Vector<Real>& ct,
+			     const Vector<MultiFab*>& fmf, const Vector<Real>& ft,
+			     int scomp, int dcomp, int ncomp,
+			     const Geometry& cgeom, const Geometry& fgeom,
+			     PhysBCFunctBase& cbc, int cbccomp,
+                             PhysBCFunctBase& fbc, int fbccomp,
+			     const IntVect& ratio,
+			     Interpolater* mapper,
+                             const Vector<BCRec>& bcs, int bcscomp,
+                             const InterpHook& pre_interp,
+                             const InterpHook& post_interp)
+    {
+	BL_PROFILE("FillPatchTwoLevels");
+
+	BL_ASSERT(cmf.size() == ct.size());
+	BL_ASSERT(cmf.size() == 1 || cmf.size() == 2);
+
+	if (mf.nGrow() > 0 || mf.getBDKey() != fmf[0]->getBDKey())
+	{
+	    if (!plan.isValid(mf, *fmf[0], fgeom, ratio, mapper)) {
+		plan.define(mf, *fmf[0], cgeom, fgeom, ratio, mapper);
+	    }
+
+	    if ( ! plan.ba_crse_patch.empty())
+	    {
+		MultiFab& mf_crse_patch = plan.crsePatch(0, ncomp);
+
+                mf_crse_patch.setDomainBndry(std::numeric_limits<Real>::quiet_NaN(), 0, ncomp, cgeom);
+
+		// Only the patches are interpolated in time, not the whole
+		// coarse level.
+		mf_crse_patch.copy(*cmf[0], scomp, 0, ncomp, cgeom.periodicity());
+		if (cmf.size() == 2)
+		{
+		    MultiFab& mf_crse_patch_1 = plan.crsePatch(1, ncomp);
+		    mf_crse_patch_1.setDomainBndry(std::numeric_limits<Real>::quiet_NaN(), 0, ncomp, cgeom);
+		    mf_crse_patch_1.copy(*cmf[1], scomp, 0, ncomp, cgeom.periodicity());
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+		    for (MFIter mfi(mf_crse_patch,true); mfi.isValid(); ++mfi)
+		    {
+			const Box& bx = mfi.tilebox();
+			mf_crse_patch[mfi].linInterp(mf_crse_patch[mfi], 0, mf_crse_patch_1[mfi], 0,
+						     ct[0], ct[1], time, bx, 0, ncomp);
+		    }
+		}
+
+		cbc.FillBoundary(mf_crse_patch, 0, ncomp, time, cbccomp);
+
+		const Vector<BCRec>& patch_bcs = plan.patchBCs(bcs, bcscomp, ncomp);
+
+		int idummy1=0, idummy2=0;
+		bool cc = plan.ba_crse_patch.ixType().cellCentered();
+                ignore_unused(cc);
+#ifdef _OPENMP
+#pragma omp parallel if (cc)
+#endif
+                {
+                    Vector<BCRec> bcr(ncomp);
+                    for (MFIter mfi(mf_crse_patch); mfi.isValid(); ++mfi)
+                    {
+                        FArrayBox& sfab = mf_crse_patch[mfi];
+                        int li = mfi.LocalIndex();
+                        int gi = plan.dst_idxs[li];
+                        FArrayBox& dfab = mf[gi];
+                        const Box& dbx = plan.dst_boxes[li];
+
+                        std::copy(patch_bcs.begin()+li*ncomp, patch_bcs.begin()+(li+1)*ncomp,
+                                  bcr.begin());
+
+                        pre_interp(sfab, sfab.box(), 0, ncomp);
+
+                        mapper->interp(sfab,
+                                       0,
+                                       dfab,
+                                       dcomp,
+                                       ncomp,
+                                       dbx,
+                                       ratio,
+                                       cgeom,
+                                       fgeom,
+                                       bcr,
+                                       idummy1, idummy2);
+
+                        post_interp(dfab, dbx, dcomp, ncomp);
+                    }
+                }
+	    }
+	}
+
+	FillPatchSingleLevel(mf, time, fmf, ft, scomp, dcomp, ncomp, fgeom, fbc, fbccomp);
+    }
+
+    void FillPatchTwoLevels_nowait (FillPatchPlan& plan, MultiFab& mf, Real time,
+                                    const Vector<MultiFab*>& cmf, const Vector<Real>& ct,
+                                    const Vector<MultiFab*>& fmf, const Vector<Real>& ft,
+                                    int scomp, int dcomp, int ncomp,
+                                    const Geometry& cgeom, const Geometry& fgeom,
+                                    PhysBCFunctBase& cbc, int cbccomp,
+                                    PhysBCFunctBase& fbc, int fbccomp,
+                                    const IntVect& ratio,
+                                    Interpolater* mapper,
+                                    const Vector<BCRec>& bcs, int bcscomp,
+                                    const InterpHook& pre_interp,
+                                    const InterpHook& post_interp,
+                                    bool fill_fine)
+    {
+	BL_PROFILE("FillPatchTwoLevels_nowait");
+
+	BL_ASSERT(!plan.isPending());
+	BL_ASSERT(cmf.size() == ct.size());
+	BL_ASSERT(cmf.size() == 1 || cmf.size() == 2);
+	BL_ASSERT(fmf.size() == ft.size());
+	BL_ASSERT(fmf.size() == 1 || fmf.size() == 2);
+	BL_ASSERT(scomp+ncomp <= fmf[0]->nComp());
+	BL_ASSERT(dcomp+ncomp <= mf.nComp());
+
+        using CopierHandle = FabArray<FArrayBox>::CopierHandle;
+
+	FillPatchPlan::Pending& p = plan.m_pending;
+	p.mf      = &mf;
+	p.time    = time;
+	p.ct      = ct;
+	p.dcomp   = dcomp;
+	p.ncomp   = ncomp;
+	p.cbccomp = cbccomp;
+	p.fbccomp = fbccomp;
+	p.cgeom   = cgeom;
+	p.fgeom   = fgeom;
+	p.ratio   = ratio;
+	p.mapper  = mapper;
+	p.crse    = false;
+
+	if (mf.nGrow() > 0 || mf.getBDKey() != fmf[0]->getBDKey())
+	{
+	    if (!plan.isValid(mf, *fmf[0], fgeom, ratio, mapper)) {
+		plan.define(mf, *fmf[0], cgeom, fgeom, ratio, mapper);
+	    }
+
+	    if ( ! plan.ba_crse_patch.empty())
+	    {
+		if (plan.m_crse_ba != cmf[0]->boxArray() ||
+		    plan.m_crse_dm != cmf[0]->DistributionMap())
+		{
+		    plan.defineAsync(*cmf[0], *fmf[0], cgeom, fgeom);
+		}
+		plan.patchBCs(bcs, bcscomp, ncomp);
+		p.crse = true;
+
+		// Post the coarse data that need messages first.
+		if ( ! plan.m_async_patches[1].ba.empty())
+		{
+		    for (int i = 0, N = cmf.size(); i < N; ++i)
+		    {
+			MultiFab& dst = plan.asyncPatch(1, i, ncomp);
+			dst.setDomainBndry(std::numeric_limits<Real>::quiet_NaN(), 0, ncomp, cgeom);
+			p.crse_handle[i].reset(new CopierHandle(
+			    dst.ParallelCopy_nowait(*cmf[i], scomp, 0, ncomp, IntVect(0), IntVect(0),
+						    cgeom.periodicity())));
+		    }
+		}
+	    }
+	}
+
+	// Start the fine-level part of FillPatchSingleLevel.
+	const IntVect dst_ngrow(mf.nGrow());
+	if (!fill_fine)
+	{
+	    // The caller does it.
+	}
+	else if (fmf.size() == 1)
+	{
+	    p.fine_handle.reset(new CopierHandle(
+		mf.ParallelCopy_nowait(*fmf[0], scomp, dcomp, ncomp, IntVect(0), dst_ngrow,
+				       fgeom.periodicity())));
+	}
+	else
+	{
+	    BL_ASSERT(fmf[0]->boxArray() == fmf[1]->boxArray());
+	    const bool sameba = (mf.boxArray() == fmf[0]->boxArray());
+	    MultiFab* dmf = &mf;
+	    int destcomp = dcomp;
+	    if (!sameba) {
+		p.fine_tmp.reset(new MultiFab(fmf[0]->boxArray(), fmf[0]->DistributionMap(), ncomp, 0,
+					      MFInfo(), fmf[0]->Factory()));
+		dmf = p.fine_tmp.get();
+		destcomp = 0;
+	    }
+
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+	    for (MFIter mfi(*dmf,TilingIfNotGPU()); mfi.isValid(); ++mfi)
+	    {
+		const Box& bx = mfi.tilebox();
+                FArrayBox* dfab = dmf->fabPtr(mfi);
+                FArrayBox* sfab0 = fmf[0]->fabPtr(mfi);
+                FArrayBox* sfab1 = fmf[1]->fabPtr(mfi);
+                const Real t0 = ft[0];
+                const Real t1 = ft[1];
+
+                AMREX_LAUNCH_HOST_DEVICE_LAMBDA ( bx, tbx,
+                {
+                    dfab->linInterp(*sfab0,scomp,*sfab1,scomp,t0,t1,time,tbx,destcomp,ncomp);
+                });
+	    }
+
+	    if (sameba) {
+		mf.FillBoundary_nowait(dcomp, ncomp, fgeom.periodicity());
+		p.fine_fb = true;
+	    } else {
+		p.fine_handle.reset(new CopierHandle(
+		    mf.ParallelCopy_nowait(*p.fine_tmp, 0, dcomp, ncomp, IntVect(0), dst_ngrow,
+					   fgeom.periodicity())));
+	    }
+	}
+
+	// The patches whose coarse data are all local are done while the
+	// messages are in flight.
+	if (p.crse && ! plan.m_async_patches[0].ba.empty())
+	{
+	    for (int i = 0, N = cmf.size(); i < N; ++i)
+	    {
+		MultiFab& dst = plan.asyncPatch(0, i, ncomp);
+		dst.setDomainBndry(std::numeric_limits<Real>::quiet_NaN(), 0, ncomp, cgeom);
+		dst.copy(*cmf[i], scomp, 0, ncomp, cgeom.periodicity());
+	    }
+	    plan.interpAsyncPatches(0, cbc, pre_interp, post_interp);
+	}
+    }
+
+    void FillPatchTwoLevels_finish (FillPatchPlan& plan,
+                                    PhysBCFunctBase& cbc, PhysBCFunctBase& fbc,
+                                    const InterpHook& pre_interp,
+                                    const InterpHook& post_interp)
+    {
+	BL_PROFILE("FillPatchTwoLevels_finish");
+
+	BL_ASSERT(plan.isPending());
+
+	FillPatchPlan::Pending& p = plan.m_pending;
+
+	for (auto& h : p.crse_handle) {
+	    if (h) {
+		h->finish();
+		h.reset();
+	    }
+	}
+	plan.interpAsyncPatches(1, cbc, pre_interp, post_interp);
+
+	if (p.fine_fb) {
+	    p.mf->FillBoundary_finish();
+	    p.fine_fb = false;
+	} else if (p.fine_handle) {
+	    p.fine_handle->finish();
+	}
+	p.fine_handle.reset();
+	p.fine_tmp.reset();
+
+	fbc.FillBoundary(*p.mf, p.dcomp, p.ncomp, p.time, p.fbccomp);
+
+	p.mf = nullptr;
+    }
+
     void InterpFromCoarseLevel (MultiFab& mf, Real time, const MultiFab& cmf,
 				int scomp, int dcomp, int ncomp,
 				const Geometry& cgeom, const Geometry& fgeom,
@@ -90,6 +90,8 @@ FluxRegister::define (const BoxArray&            fine_boxes,
 void
 FluxRegister::clear ()
 {
+    async_handles.clear();
+    async_flux.clear();
     BndryRegister::clear();
 }
 
@@ -418,17 +420,44 @@ FluxRegister::Reflux (MultiFab&       mf,
 {
     BL_PROFILE("FluxRegister::Reflux()");
 
+    const bool async = !async_flux.empty();
+    if (async)
+    {
+        if (async_flux[0]->boxArray() != amrex::convert(mf.boxArray(), async_flux[0]->ixType()) ||
+            async_flux[0]->DistributionMap() != mf.DistributionMap())
+        {
+            amrex::Abort("FluxRegister::Reflux: mf does not match the layout of Reflux_nowait");
+        }
+        for (auto& h : async_handles) {
+            h.finish();
+        }
+        async_handles.clear();
+    }
+
     for (OrientationIter fi; fi; ++fi)
     {
 	const Orientation& face = fi();
 	int idir = face.coordDir();
 	int islo = face.isLow();
 
-        MultiFab flux(amrex::convert(mf.boxArray(), IntVect::TheDimensionVector(idir)),
-                      mf.DistributionMap(), nc, 0, MFInfo(), mf.Factory());
-	flux.setVal(0.0);
-
-	bndry[face].copyTo(flux, 0, scomp, 0, nc, geom.periodicity());
+        MultiFab tmp;
+        const MultiFab* pflux;
+        int fcomp;
+        if (async)
+        {
+            pflux = async_flux[face].get();
+            fcomp = scomp;
+        }
+        else
+        {
+            tmp.define(amrex::convert(mf.boxArray(), IntVect::TheDimensionVector(idir)),
+                       mf.DistributionMap(), nc, 0, MFInfo(), mf.Factory());
+            tmp.setVal(0.0);
+            bndry[face].copyTo(tmp, 0, scomp, 0, nc, geom.periodicity());
+            pflux = &tmp;
+            fcomp = 0;
+        }
+        const MultiFab& flux = *pflux;
 
 #ifdef _OPENMP
 #pragma omp parallel
@@ -448,12 +477,14 @@ FluxRegister::Reflux (MultiFab&       mf,
 
 	    amrex_frreflux(bx.loVect(), bx.hiVect(),
 			  sfab.dataPtr(dcomp), sbox.loVect(), sbox.hiVect(),
-			  ffab.dataPtr(     ), fbox.loVect(), fbox.hiVect(),
+			  ffab.dataPtr(fcomp), fbox.loVect(), fbox.hiVect(),
 			  vfab.dataPtr(     ), vfab.loVect(), vbox.hiVect(),
 			  &nc, &scale, &idir, &islo);
 			  
 	}
     }
+
+    async_flux.clear();
 }
 
 void 
@@ -474,6 +505,41 @@ FluxRegister::Reflux (MultiFab&       mf,
     Reflux(mf,volume,scale,scomp,dcomp,nc,geom);
 }
 
+void
+FluxRegister::Reflux_nowait (const BoxArray&            crse_ba,
+                             const DistributionMapping& crse_dm,
+                             const Geometry&            crse_geom)
+{
+    BL_PROFILE("FluxRegister::Reflux_nowait()");
+
+    if (async_flux.empty())
+    {
+        async_flux.resize(2*AMREX_SPACEDIM);
+        for (OrientationIter fi; fi; ++fi)
+        {
+            const Orientation& face = fi();
+            const IntVect& typ = IntVect::TheDimensionVector(face.coordDir());
+            async_flux[face].reset(new MultiFab(amrex::convert(crse_ba,typ), crse_dm, ncomp, 0));
+            async_flux[face]->setVal(0.0);
+        }
+    }
+    else if (async_flux[0]->boxArray() != amrex::convert(crse_ba, async_flux[0]->ixType()) ||
+             async_flux[0]->DistributionMap() != crse_dm)
+    {
+        amrex::Abort("FluxRegister::Reflux_nowait: the coarse layout changed before Reflux");
+    }
+
+    // The messages are packed before plusTo_nowait returns, so the register can be reused.
+    for (OrientationIter fi; fi; ++fi)
+    {
+        const Orientation& face = fi();
+        async_handles.push_back(bndry[face].plusTo_nowait(*async_flux[face], 0, 0, 0, ncomp,
+                                                          crse_geom.periodicity()));
+    }
+
+    setVal(0.0);
+}
+
 void
 FluxRegister::ClearInternalBorders (const Geometry& geom)
 {
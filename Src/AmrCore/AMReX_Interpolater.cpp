@@ -28,6 +28,78 @@ CellConservativeQuartic   quartic_interp;
 
 Interpolater::~Interpolater () {}
 
+namespace {
+
+//
+// Offsets of the centers of the fine cells covering cslope_bx from the
+// centers of their coarse cells, in units of the coarse cell size.  They
+// are computed in volume coordinates, so this works in any coordinate
+// system.
+//
+void
+interp_voff (Vector<Real>*   voff,
+             const Box&      cslope_bx,
+             const IntVect&  ratio,
+             const Geometry& crse_geom,
+             const Geometry& fine_geom)
+{
+    const Box& fslope_bx = amrex::refine(cslope_bx,ratio);
+    for (int dir = 0; dir < AMREX_SPACEDIM; dir++)
+    {
+        Vector<Real> fvc, cvc;
+        fine_geom.GetEdgeVolCoord(fvc,fslope_bx,dir);
+        crse_geom.GetEdgeVolCoord(cvc,cslope_bx,dir);
+
+        const int len = fslope_bx.length(dir);
+        voff[dir].resize(len);
+        for (int i = 0; i < len; i++)
+        {
+            const int  ic   = i/ratio[dir];
+            const Real fcen = 0.5*(fvc[i]+fvc[i+1]);
+            const Real ccen = 0.5*(cvc[ic]+cvc[ic+1]);
+            voff[dir][i] = (fcen-ccen)/(cvc[ic+1]-cvc[ic]);
+        }
+    }
+}
+
+//
+// Conservative linear interpolation of CellConservativeLinear and
+// CellConservativeProtected.  The offsets of the fine cell centers are
+// computed in volume coordinates, so this works in any coordinate system.
+//
+void
+lincc_interp_fab (const FArrayBox&     crse,
+                  int                  crse_comp,
+                  FArrayBox&           fine,
+                  int                  fine_comp,
+                  int                  ncomp,
+                  const Box&           fine_region,
+                  const IntVect&       ratio,
+                  const Geometry&      crse_geom,
+                  const Geometry&      fine_geom,
+                  const Vector<BCRec>& bcr,
+                  bool                 lin_limit)
+{
+    //
+    // Make box which is intersection of fine_region and domain of fine.
+    //
+    const Box& target_fine_region = fine_region & fine.box();
+    //
+    // Slopes are needed only on coarsening of target_fine_region.
+    //
+    const Box& cslope_bx = amrex::coarsen(target_fine_region,ratio);
+    BL_ASSERT(crse.box().contains(amrex::grow(cslope_bx,1)));
+
+    Vector<Real> voff[AMREX_SPACEDIM];
+    interp_voff(voff, cslope_bx, ratio, crse_geom, fine_geom);
+
+    amrex_lincc_interp(target_fine_region, fine, fine_comp, ncomp, crse, crse_comp, ratio,
+                       bcr.dataPtr(), lin_limit,
+                       AMREX_D_DECL(voff[0].dataPtr(),voff[1].dataPtr(),voff[2].dataPtr()));
+}
+
+}
+
 InterpolaterBoxCoarsener
 Interpolater::BoxCoarsener (const IntVect& ratio)
 {
@@ -103,29 +175,10 @@ NodeBilinear::interp (const FArrayBox&  crse,
                       int               actual_state)
 {
     BL_PROFILE("NodeBilinear::interp()");
-    //
-    // Set up to call FORTRAN.
-    //
-    const int* clo = crse.box().loVect();
-    const int* chi = crse.box().hiVect();
-    const int* flo = fine.loVect();
-    const int* fhi = fine.hiVect();
-    const int* lo  = fine_region.loVect();
-    const int* hi  = fine_region.hiVect();
-    int num_slope  = AMREX_D_TERM(2,*2,*2)-1;
-    int len0       = crse.box().length(0);
-    int slp_len    = num_slope*len0;
 
-    Vector<Real> strip(slp_len);
+    const Box& target_fine_region = fine_region & fine.box();
 
-    const Real* cdat  = crse.dataPtr(crse_comp);
-    Real*       fdat  = fine.dataPtr(fine_comp);
-    const int* ratioV = ratio.getVect();
-
-    amrex_nbinterp (cdat,AMREX_ARLIM(clo),AMREX_ARLIM(chi),AMREX_ARLIM(clo),AMREX_ARLIM(chi),
-                   fdat,AMREX_ARLIM(flo),AMREX_ARLIM(fhi),AMREX_ARLIM(lo),AMREX_ARLIM(hi),
-                   AMREX_D_DECL(&ratioV[0],&ratioV[1],&ratioV[2]),&ncomp,
-                   strip.dataPtr(),&num_slope,&actual_comp,&actual_state);
+    amrex_nodebilin_interp(target_fine_region, fine, fine_comp, ncomp, crse, crse_comp, ratio);
 }
 
 CellBilinear::~CellBilinear () {}
@@ -272,119 +325,8 @@ CellConservativeLinear::interp (const FArrayBox& crse,
     BL_PROFILE("CellConservativeLinear::interp()");
     BL_ASSERT(bcr.size() >= ncomp);
 
-    //
-    // Make box which is intersection of fine_region and domain of fine.
-    //
-    Box target_fine_region = fine_region & fine.box();
-    //
-    // crse_bx is coarsening of target_fine_region, grown by 1.
-    //
-    Box crse_bx = CoarseBox(target_fine_region,ratio);
-    //
-    // Slopes are needed only on coarsening of target_fine_region.
-    //
-    Box cslope_bx(crse_bx);
-    cslope_bx.grow(-1);
-    //
-    // Make a refinement of cslope_bx
-    //
-    Box fine_version_of_cslope_bx = amrex::refine(cslope_bx,ratio);
-    //
-    // Get coarse and fine edge-centered volume coordinates.
-    //
-    Vector<Real> fvc[AMREX_SPACEDIM];
-    Vector<Real> cvc[AMREX_SPACEDIM];
-    int dir;
-    for (dir = 0; dir < AMREX_SPACEDIM; dir++)
-    {
-        fine_geom.GetEdgeVolCoord(fvc[dir],fine_version_of_cslope_bx,dir);
-        crse_geom.GetEdgeVolCoord(cvc[dir],crse_bx,dir);
-    }
-    //
-    // alloc tmp space for slope calc.
-    //
-    // In ucc_slopes and lcc_slopes , there is a slight abuse of
-    // the number of compenents argument
-    // --> there is a slope for each component in each coordinate
-    //     direction
-    //
-    FArrayBox ucc_slopes(cslope_bx,ncomp*AMREX_SPACEDIM);
-    FArrayBox lcc_slopes(cslope_bx,ncomp*AMREX_SPACEDIM);
-    FArrayBox slope_factors(cslope_bx,AMREX_SPACEDIM);
-
-    FArrayBox  cmax(cslope_bx,ncomp);
-    FArrayBox  cmin(cslope_bx,ncomp);
-    FArrayBox alpha(cslope_bx,ncomp);
-
-    Real* fdat       = fine.dataPtr(fine_comp);
-    const Real* cdat = crse.dataPtr(crse_comp);
-    Real* ucc_xsldat = ucc_slopes.dataPtr(0);
-    Real* lcc_xsldat = lcc_slopes.dataPtr(0);
-    Real* xslfac_dat = slope_factors.dataPtr(0);
-#if (AMREX_SPACEDIM>=2)
-    Real* ucc_ysldat = ucc_slopes.dataPtr(ncomp);
-    Real* lcc_ysldat = lcc_slopes.dataPtr(ncomp);
-    Real* yslfac_dat = slope_factors.dataPtr(1);
-#endif
-#if (AMREX_SPACEDIM==3)
-    Real* ucc_zsldat = ucc_slopes.dataPtr(2*ncomp);
-    Real* lcc_zsldat = lcc_slopes.dataPtr(2*ncomp);
-    Real* zslfac_dat = slope_factors.dataPtr(2);
-#endif
-
-    const int* flo    = fine.loVect();
-    const int* fhi    = fine.hiVect();
-    const int* clo    = crse.loVect();
-    const int* chi    = crse.hiVect();
-    const int* fblo   = target_fine_region.loVect();
-    const int* fbhi   = target_fine_region.hiVect();
-    const int* csbhi  = cslope_bx.hiVect();
-    const int* csblo  = cslope_bx.loVect();
-    int lin_limit     = (do_linear_limiting ? 1 : 0);
-    const int* cvcblo = crse_bx.loVect();
-    const int* fvcblo = fine_version_of_cslope_bx.loVect();
-    int slope_flag    = 1;
-
-    int cvcbhi[AMREX_SPACEDIM];
-    int fvcbhi[AMREX_SPACEDIM];
-
-    for (dir=0; dir<AMREX_SPACEDIM; dir++)
-    {
-        cvcbhi[dir] = cvcblo[dir] + cvc[dir].size() - 1;
-        fvcbhi[dir] = fvcblo[dir] + fvc[dir].size() - 1;
-    }
-
-    AMREX_D_TERM(Real* voffx = new Real[fvc[0].size()];,
-           Real* voffy = new Real[fvc[1].size()];,
-           Real* voffz = new Real[fvc[2].size()];);
-
-    Vector<int> bc     = GetBCArray(bcr);
-    const int* ratioV = ratio.getVect();
-
-    amrex_linccinterp (fdat,AMREX_ARLIM(flo),AMREX_ARLIM(fhi),
-                      fblo, fbhi,
-                      AMREX_ARLIM(fvcblo), AMREX_ARLIM(fvcbhi),
-                      cdat,AMREX_ARLIM(clo),AMREX_ARLIM(chi),
-                      AMREX_ARLIM(cvcblo), AMREX_ARLIM(cvcbhi),
-                      ucc_xsldat, lcc_xsldat, xslfac_dat,
-#if (AMREX_SPACEDIM>=2)
-                      ucc_ysldat, lcc_ysldat, yslfac_dat,
-#endif
-#if (AMREX_SPACEDIM==3)
-                      ucc_zsldat, lcc_zsldat, zslfac_dat,
-#endif
-                      AMREX_ARLIM(csblo), AMREX_ARLIM(csbhi),
-                      csblo, csbhi,
-                      &ncomp,AMREX_D_DECL(&ratioV[0],&ratioV[1],&ratioV[2]),
-                      bc.dataPtr(), &slope_flag, &lin_limit,
-                      AMREX_D_DECL(fvc[0].dataPtr(),fvc[1].dataPtr(),fvc[2].dataPtr()),
-                      AMREX_D_DECL(cvc[0].dataPtr(),cvc[1].dataPtr(),cvc[2].dataPtr()),
-                      AMREX_D_DECL(voffx,voffy,voffz),
-                      alpha.dataPtr(),cmax.dataPtr(),cmin.dataPtr(),
-                      &actual_comp,&actual_state);
-
-    AMREX_D_TERM(delete [] voffx;, delete [] voffy;, delete [] voffz;);
-
+    lincc_interp_fab(crse, crse_comp, fine, fine_comp, ncomp, fine_region, ratio,
+                     crse_geom, fine_geom, bcr, do_linear_limiting);
 }
 
 CellQuadratic::CellQuadratic (bool limit)
@@ -428,89 +370,22 @@ CellQuadratic::interp (const FArrayBox& crse,
 {
     BL_PROFILE("CellQuadratic::interp()");
     BL_ASSERT(bcr.size() >= ncomp);
+#if (AMREX_SPACEDIM == 2)
     //
     // Make box which is intersection of fine_region and domain of fine.
     //
-    Box target_fine_region = fine_region & fine.box();
-
-    Box crse_bx(amrex::coarsen(target_fine_region,ratio));
-    Box fslope_bx(amrex::refine(crse_bx,ratio));
-    Box cslope_bx(crse_bx);
-    cslope_bx.grow(1);
-    BL_ASSERT(crse.box().contains(cslope_bx));
-    //
-    // Alloc temp space for coarse grid slopes: here we use 5
-    // instead of AMREX_SPACEDIM because of the x^2, y^2 and xy terms
-    //
-    long t_long = cslope_bx.numPts();
-    BL_ASSERT(t_long < INT_MAX);
-    int c_len = int(t_long);
-
-    Vector<Real> cslope(5*c_len);
-
-    int loslp = cslope_bx.index(crse_bx.smallEnd());
-    int hislp = cslope_bx.index(crse_bx.bigEnd());
-
-    t_long = cslope_bx.numPts();
-    BL_ASSERT(t_long < INT_MAX);
-    int cslope_vol = int(t_long);
-    int clo        = 1 - loslp;
-    int chi        = clo + cslope_vol - 1;
-    c_len          = hislp - loslp + 1;
-    //
-    // Alloc temp space for one strip of fine grid slopes: here we use 5
-    // instead of AMREX_SPACEDIM because of the x^2, y^2 and xy terms.
-    //
-    int dir;
-    int f_len = fslope_bx.longside(dir);
-
-    Vector<Real> strip((5+2)*f_len);
-
-    Real* fstrip = strip.dataPtr();
-    Real* foff   = fstrip + f_len;
-    Real* fslope = foff + f_len;
-    //
-    // Get coarse and fine edge-centered volume coordinates.
-    //
-    Vector<Real> fvc[AMREX_SPACEDIM];
-    Vector<Real> cvc[AMREX_SPACEDIM];
-    for (dir = 0; dir < AMREX_SPACEDIM; dir++)
-    {
-        fine_geom.GetEdgeVolCoord(fvc[dir],target_fine_region,dir);
-        crse_geom.GetEdgeVolCoord(cvc[dir],crse_bx,dir);
-    }
-    //
-    // Alloc tmp space for slope calc and to allow for vectorization.
-    //
-    Real* fdat        = fine.dataPtr(fine_comp);
-    const Real* cdat  = crse.dataPtr(crse_comp);
-    const int* flo    = fine.loVect();
-    const int* fhi    = fine.hiVect();
-    const int* fblo   = target_fine_region.loVect();
-    const int* fbhi   = target_fine_region.hiVect();
-    const int* cblo   = crse_bx.loVect();
-    const int* cbhi   = crse_bx.hiVect();
-    const int* fslo   = fslope_bx.loVect();
-    const int* fshi   = fslope_bx.hiVect();
-    int slope_flag    = (do_limited_slope ? 1 : 0);
-    Vector<int> bc     = GetBCArray(bcr);
-    const int* ratioV = ratio.getVect();
+    const Box& target_fine_region = fine_region & fine.box();
+    const Box& crse_bx = amrex::coarsen(target_fine_region,ratio);
+    BL_ASSERT(crse.box().contains(amrex::grow(crse_bx,1)));
 
-#if (AMREX_SPACEDIM > 1)
-
-    amrex_cqinterp (fdat,AMREX_ARLIM(flo),AMREX_ARLIM(fhi),
-                   AMREX_ARLIM(fblo), AMREX_ARLIM(fbhi),
-                   &ncomp,AMREX_D_DECL(&ratioV[0],&ratioV[1],&ratioV[2]),
-                   cdat,&clo,&chi,
-                   AMREX_ARLIM(cblo), AMREX_ARLIM(cbhi),
-                   fslo,fshi,
-                   cslope.dataPtr(),&c_len,fslope,fstrip,&f_len,foff,
-                   bc.dataPtr(), &slope_flag,
-                   AMREX_D_DECL(fvc[0].dataPtr(),fvc[1].dataPtr(),fvc[2].dataPtr()),
-                   AMREX_D_DECL(cvc[0].dataPtr(),cvc[1].dataPtr(),cvc[2].dataPtr()),
-                   &actual_comp,&actual_state);
+    Vector<Real> voff[AMREX_SPACEDIM];
+    interp_voff(voff, crse_bx, ratio, crse_geom, fine_geom);
 
-#endif /*(AMREX_SPACEDIM > 1)*/
+    amrex_cqinterp(target_fine_region, fine, fine_comp, ncomp, crse, crse_comp, ratio,
+                   bcr.dataPtr(), voff[0].dataPtr(), voff[1].dataPtr());
+#elif (AMREX_SPACEDIM == 3)
+    amrex::Abort("CellQuadratic::interp: quadratic interpolation is not implemented in 3D");
+#endif
 }
 
 PCInterp::~PCInterp () {}
@@ -544,42 +419,10 @@ PCInterp::interp (const FArrayBox& crse,
                   int               actual_state)
 {
     BL_PROFILE("PCInterp::interp()");
-    //
-    // Set up to call FORTRAN.
-    //
-    const int* clo  = crse.box().loVect();
-    const int* chi  = crse.box().hiVect();
-    const int* flo  = fine.loVect();
-    const int* fhi  = fine.hiVect();
-    const int* fblo = fine_region.loVect();
-    const int* fbhi = fine_region.hiVect();
 
-    Box cregion(amrex::coarsen(fine_region,ratio));
-
-    const int* cblo = cregion.loVect();
-    const int* cbhi = cregion.hiVect();
-
-    int long_dir;
-    int long_len = cregion.longside(long_dir);
-    int s_len    = long_len*ratio[long_dir];
-
-    Vector<Real> strip(s_len);
-
-    int strip_lo = ratio[long_dir] * cblo[long_dir];
-    int strip_hi = ratio[long_dir] * (cbhi[long_dir]+1) - 1;
-    //
-    // Convert long_dir to FORTRAN (1 based) index.
-    //
-    long_dir++;
-    const Real* cdat  = crse.dataPtr(crse_comp);
-    Real*       fdat  = fine.dataPtr(fine_comp);
-    const int* ratioV = ratio.getVect();
+    const Box& target_fine_region = fine_region & fine.box();
 
-    amrex_pcinterp (cdat,AMREX_ARLIM(clo),AMREX_ARLIM(chi),cblo,cbhi,
-                   fdat,AMREX_ARLIM(flo),AMREX_ARLIM(fhi),fblo,fbhi,
-                   &long_dir,AMREX_D_DECL(&ratioV[0],&ratioV[1],&ratioV[2]),
-                   &ncomp,strip.dataPtr(),&strip_lo,&strip_hi,
-                   &actual_comp,&actual_state);
+    amrex_pcinterp_interp(target_fine_region, fine, fine_comp, ncomp, crse, crse_comp, ratio);
 }
 
 CellConservativeProtected::CellConservativeProtected () {}
@@ -620,125 +463,16 @@ CellConservativeProtected::interp (const FArrayBox& crse,
 {
     BL_PROFILE("CellConservativeProtected::interp()");
     BL_ASSERT(bcr.size() >= ncomp);
-    //
-    // Make box which is intersection of fine_region and domain of fine.
-    //
-    Box target_fine_region = fine_region & fine.box();
-    //
-    // crse_bx is coarsening of target_fine_region, grown by 1.
-    //
-    Box crse_bx = CoarseBox(target_fine_region,ratio);
-    //
-    // Slopes are needed only on coarsening of target_fine_region.
-    //
-    Box cslope_bx(crse_bx);
-    cslope_bx.grow(-1);
-    //
-    // Make a refinement of cslope_bx
-    //
-    Box fine_version_of_cslope_bx = amrex::refine(cslope_bx,ratio);
-    //
-    // Get coarse and fine edge-centered volume coordinates.
-    //
-    Vector<Real> fvc[AMREX_SPACEDIM];
-    Vector<Real> cvc[AMREX_SPACEDIM];
-    int dir;
-    for (dir = 0; dir < AMREX_SPACEDIM; dir++)
-    {
-        fine_geom.GetEdgeVolCoord(fvc[dir],fine_version_of_cslope_bx,dir);
-        crse_geom.GetEdgeVolCoord(cvc[dir],crse_bx,dir);
-    }
-    //
-    // alloc tmp space for slope calc.
-    //
-    // In ucc_slopes and lcc_slopes , there is a slight abuse of
-    // the number of compenents argument
-    // --> there is a slope for each component in each coordinate
-    //     direction
-    //
-    FArrayBox ucc_slopes(cslope_bx,ncomp*AMREX_SPACEDIM);
-    FArrayBox lcc_slopes(cslope_bx,ncomp*AMREX_SPACEDIM);
-    FArrayBox slope_factors(cslope_bx,AMREX_SPACEDIM);
-
-    FArrayBox  cmax(cslope_bx,ncomp);
-    FArrayBox  cmin(cslope_bx,ncomp);
-    FArrayBox alpha(cslope_bx,ncomp);
-
-    Real* fdat       = fine.dataPtr(fine_comp);
-    const Real* cdat = crse.dataPtr(crse_comp);
-    Real* ucc_xsldat = ucc_slopes.dataPtr(0);
-    Real* lcc_xsldat = lcc_slopes.dataPtr(0);
-    Real* xslfac_dat = slope_factors.dataPtr(0);
-#if (AMREX_SPACEDIM>=2)
-    Real* ucc_ysldat = ucc_slopes.dataPtr(ncomp);
-    Real* lcc_ysldat = lcc_slopes.dataPtr(ncomp);
-    Real* yslfac_dat = slope_factors.dataPtr(1);
-#endif
-#if (AMREX_SPACEDIM==3)
-    Real* ucc_zsldat = ucc_slopes.dataPtr(2*ncomp);
-    Real* lcc_zsldat = lcc_slopes.dataPtr(2*ncomp);
-    Real* zslfac_dat = slope_factors.dataPtr(2);
-#endif
-
-    const int* flo    = fine.loVect();
-    const int* fhi    = fine.hiVect();
-    const int* clo    = crse.loVect();
-    const int* chi    = crse.hiVect();
-    const int* fblo   = target_fine_region.loVect();
-    const int* fbhi   = target_fine_region.hiVect();
-    const int* csbhi  = cslope_bx.hiVect();
-    const int* csblo  = cslope_bx.loVect();
-    int lin_limit     = 1;
-    const int* cvcblo = crse_bx.loVect();
-    const int* fvcblo = fine_version_of_cslope_bx.loVect();
-
-    int cvcbhi[AMREX_SPACEDIM];
-    int fvcbhi[AMREX_SPACEDIM];
-
-    for (dir=0; dir<AMREX_SPACEDIM; dir++)
-    {
-        cvcbhi[dir] = cvcblo[dir] + cvc[dir].size() - 1;
-        fvcbhi[dir] = fvcblo[dir] + fvc[dir].size() - 1;
-    }
-
-    AMREX_D_TERM(Real* voffx = new Real[fvc[0].size()];,
-           Real* voffy = new Real[fvc[1].size()];,
-           Real* voffz = new Real[fvc[2].size()];);
-
-    Vector<int> bc     = GetBCArray(bcr);
-    const int* ratioV = ratio.getVect();
-    int slope_flag    = 1;
 
 #if (AMREX_SPACEDIM > 1)
-
-    amrex_linccinterp (fdat,AMREX_ARLIM(flo),AMREX_ARLIM(fhi),
-                      fblo, fbhi,
-                      AMREX_ARLIM(fvcblo), AMREX_ARLIM(fvcbhi),
-                      cdat,AMREX_ARLIM(clo),AMREX_ARLIM(chi),
-                      AMREX_ARLIM(cvcblo), AMREX_ARLIM(cvcbhi),
-                      ucc_xsldat, lcc_xsldat, xslfac_dat,
-                      ucc_ysldat, lcc_ysldat, yslfac_dat,
-#if (AMREX_SPACEDIM==3)
-                      ucc_zsldat, lcc_zsldat, zslfac_dat,
+    lincc_interp_fab(crse, crse_comp, fine, fine_comp, ncomp, fine_region, ratio,
+                     crse_geom, fine_geom, bcr, true);
 #endif
-                      AMREX_ARLIM(csblo), AMREX_ARLIM(csbhi),
-                      csblo, csbhi,
-                      &ncomp,AMREX_D_DECL(&ratioV[0],&ratioV[1],&ratioV[2]),
-                      bc.dataPtr(), &slope_flag, &lin_limit,
-                      AMREX_D_DECL(fvc[0].dataPtr(),fvc[1].dataPtr(),fvc[2].dataPtr()),
-                      AMREX_D_DECL(cvc[0].dataPtr(),cvc[1].dataPtr(),cvc[2].dataPtr()),
-                      AMREX_D_DECL(voffx,voffy,voffz),
-                      alpha.dataPtr(),cmax.dataPtr(),cmin.dataPtr(),
-                      &actual_comp,&actual_state);
-
-    AMREX_D_TERM(delete [] voffx;, delete [] voffy;, delete [] voffz;);
-
-#endif /*(AMREX_SPACEDIM > 1)*/
 }
 
 void
-CellConservativeProtected::protect (const FArrayBox& crse,
-                                    int              crse_comp,
+CellConservativeProtected::protect (const FArrayBox& /*crse*/,
+                                    int              /*crse_comp*/,
                                     FArrayBox&       fine,
                                     int              fine_comp,
                                     FArrayBox&       fine_state,
@@ -753,84 +487,38 @@ CellConservativeProtected::protect (const FArrayBox& crse,
     BL_PROFILE("CellConservativeProtected::protect()");
     BL_ASSERT(bcr.size() >= ncomp);
 
+#if (AMREX_SPACEDIM > 1)
     //
     // Make box which is intersection of fine_region and domain of fine.
     //
-    Box target_fine_region = fine_region & fine.box();
-
-    //
-    // crse_bx is coarsening of target_fine_region, grown by 1.
-    //
-    Box crse_bx = CoarseBox(target_fine_region,ratio);
-
+    const Box& target_fine_region = fine_region & fine.box();
     //
     // cs_bx is coarsening of target_fine_region.
     //
-    Box cs_bx(crse_bx);
-    cs_bx.grow(-1);
+    const Box& cs_bx = amrex::coarsen(target_fine_region,ratio);
 
+#if (AMREX_SPACEDIM == 2)
     //
-    // Get coarse and fine edge-centered volume coordinates.
+    // Get coarse and fine edge-centered volume coordinates.  The fine ones
+    // cover all the fine cells of cs_bx in fine.
     //
-    int dir;
+    const Box& fvc_bx = amrex::refine(cs_bx,ratio) & fine.box();
+    const Box& cvc_bx = amrex::grow(cs_bx,1);
     Vector<Real> fvc[AMREX_SPACEDIM];
     Vector<Real> cvc[AMREX_SPACEDIM];
-    for (dir = 0; dir < AMREX_SPACEDIM; dir++)
+    for (int dir = 0; dir < AMREX_SPACEDIM; dir++)
     {
-        fine_geom.GetEdgeVolCoord(fvc[dir],target_fine_region,dir);
-        crse_geom.GetEdgeVolCoord(cvc[dir],crse_bx,dir);
+        fine_geom.GetEdgeVolCoord(fvc[dir],fvc_bx,dir);
+        crse_geom.GetEdgeVolCoord(cvc[dir],cvc_bx,dir);
     }
 
-#if (AMREX_SPACEDIM == 2)
-    const int* cvcblo = crse_bx.loVect();
-    const int* fvcblo = target_fine_region.loVect();
-
-    int cvcbhi[AMREX_SPACEDIM];
-    int fvcbhi[AMREX_SPACEDIM];
-
-    for (dir=0; dir<AMREX_SPACEDIM; dir++)
-    {
-        cvcbhi[dir] = cvcblo[dir] + cvc[dir].size() - 1;
-        fvcbhi[dir] = fvcblo[dir] + fvc[dir].size() - 1;
-    }
+    amrex_protect_interp(cs_bx, fine, fine_comp, ncomp, fine_state, state_comp, ratio,
+                         fvc[0].dataPtr(), fvc[1].dataPtr(), fvc_bx.smallEnd(),
+                         cvc[0].dataPtr(), cvc[1].dataPtr(), cvc_bx.smallEnd());
+#else
+    amrex_protect_interp(cs_bx, fine, fine_comp, ncomp, fine_state, state_comp, ratio);
 #endif
-
-    Real* fdat       = fine.dataPtr(fine_comp);
-    Real* state_dat  = fine_state.dataPtr(state_comp);
-    const Real* cdat = crse.dataPtr(crse_comp);
-
-    const int* flo    = fine.loVect();
-    const int* fhi    = fine.hiVect();
-    const int* slo    = fine_state.loVect();
-    const int* shi    = fine_state.hiVect();
-    const int* clo    = crse.loVect();
-    const int* chi    = crse.hiVect();
-    const int* fblo   = target_fine_region.loVect();
-    const int* fbhi   = target_fine_region.hiVect();
-    const int* csbhi  = cs_bx.hiVect();
-    const int* csblo  = cs_bx.loVect();
-
-    Vector<int> bc     = GetBCArray(bcr);
-    const int* ratioV = ratio.getVect();
-
-#if (AMREX_SPACEDIM > 1)
-
-    amrex_protect_interp (fdat,AMREX_ARLIM(flo),AMREX_ARLIM(fhi),
-                         fblo, fbhi,
-                         cdat,AMREX_ARLIM(clo),AMREX_ARLIM(chi),
-                         csblo, csbhi,
-#if (AMREX_SPACEDIM == 2)
-                         fvc[0].dataPtr(),fvc[1].dataPtr(),
-                         AMREX_ARLIM(fvcblo), AMREX_ARLIM(fvcbhi),
-                         cvc[0].dataPtr(),cvc[1].dataPtr(),
-                         AMREX_ARLIM(cvcblo), AMREX_ARLIM(cvcbhi),
 #endif
-                         state_dat, AMREX_ARLIM(slo), AMREX_ARLIM(shi),
-                         &ncomp,AMREX_D_DECL(&ratioV[0],&ratioV[1],&ratioV[2]),
-                         bc.dataPtr());
-
-#endif /*(AMREX_SPACEDIM > 1)*/
-
 }
 
 CellConservativeQuartic::~CellConservativeQuartic () {}
@@ -2,6 +2,9 @@
 #include <cstdlib>
 #include <cmath>
 #include <climits>
+#include <cstring>
+#include <cstdint>
+#include <bitset>
 
 #include <AMReX_TagBox.H>
 #include <AMReX_Geometry.H>
@@ -11,6 +14,29 @@
 
 namespace amrex {
 
+namespace {
+//
+// Tags are scanned a word of 8 at a time.  The number of tags in a word
+// is the population count of the word with each tag folded into one bit.
+//
+const int tags_per_word = 8;
+
+inline std::uint64_t
+tag_word (const TagBox::TagType* d)
+{
+    std::uint64_t w;
+    std::memcpy(&w, d, sizeof(w));
+    return w;
+}
+
+inline int
+num_tags_in_word (std::uint64_t w)
+{
+    const std::uint64_t low7 = 0x7f7f7f7f7f7f7f7fULL;
+    return std::bitset<64>((((w & low7) + low7) | w) & ~low7).count();
+}
+}
+
 TagBox::TagBox () {}
 
 TagBox::TagBox (const Box& bx,
@@ -213,10 +239,16 @@ TagBox::merge (const TagBox& src)
 long
 TagBox::numTags () const
 {
+    static_assert(sizeof(TagType) == 1, "TagBox::numTags assumes one byte tags");
     long nt = 0L;
     long len = domain.numPts();
     const TagType* d = dataPtr();
-    for (long n = 0; n < len; ++n)
+    long n = 0;
+    for ( ; n + tags_per_word <= len; n += tags_per_word)
+    {
+        nt += num_tags_in_word(tag_word(d+n));
+    }
+    for ( ; n < len; ++n)
     {
 	if (d[n] != TagBox::CLEAR)
 	    ++nt;
@@ -252,14 +284,21 @@ TagBox::collate (Vector<IntVect>& ar, int start) const
     {
         for (int j = 0; j < nj; j++)
         {
-            for (int i = 0; i < ni; i++)
+            const TagType* row = d + AMREX_D_TERM(0, +j*len[0], +k*len[0]*len[1]);
+            for (int i = 0; i < ni; )
             {
-                const TagType* dn = d + AMREX_D_TERM(i, +j*len[0], +k*len[0]*len[1]);
-                if (*dn != TagBox::CLEAR)
+                // Skip words without tags.
+                if (i + tags_per_word <= ni && tag_word(row+i) == 0)
+                {
+                    i += tags_per_word;
+                    continue;
+                }
+                if (row[i] != TagBox::CLEAR)
                 {
                     ar[start++] = IntVect(AMREX_D_DECL(lo[0]+i,lo[1]+j,lo[2]+k));
                     count++;
                 }
+                i++;
             }
         }
     }
@@ -503,27 +542,37 @@ TagBoxArray::collate (Vector<IntVect>& TheGlobalCollateSpace) const
 {
     BL_PROFILE("TagBoxArray::collate()");
 
-    long count = 0;
+    //
+    // Count the tags of each TagBox, so they can be collated in parallel.
+    //
+    Vector<long> tag_offset(local_size()+1, 0L);
 
 #ifdef _OPENMP
-#pragma omp parallel reduction(+:count)
+#pragma omp parallel
 #endif
     for (MFIter fai(*this); fai.isValid(); ++fai)
     {
-        count += get(fai).numTags();
+        tag_offset[fai.LocalIndex()+1] = get(fai).numTags();
+    }
+
+    for (int i = 0, N = local_size(); i < N; i++)
+    {
+        tag_offset[i+1] += tag_offset[i];
     }
 
+    long count = tag_offset[local_size()];
+
     //
     // Local space for holding just those tags we want to gather to the root cpu.
     //
     Vector<IntVect> TheLocalCollateSpace(count);
 
-    count = 0;
-
-    // unsafe to do OMP
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
     for (MFIter fai(*this); fai.isValid(); ++fai)
     {
-        count += get(fai).collate(TheLocalCollateSpace,count);
+        get(fai).collate(TheLocalCollateSpace,tag_offset[fai.LocalIndex()]);
     }
 
     if (count > 0)
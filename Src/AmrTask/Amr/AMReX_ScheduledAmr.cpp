@@ -0,0 +1,700 @@
+#include <algorithm>
+#include <deque>
+#include <map>
+#include <set>
+
+#include <AMReX_ScheduledAmr.H>
+#include <AMReX_AmrLevel.H>
+#include <AMReX_Interpolater.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_BLProfiler.H>
+#include <AMReX_Print.H>
+
+#include "AMReX_AbstractTask.H"
+#include "AMReX_TaskGraph.H"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace amrex {
+
+namespace
+{
+    enum StepPhase { StepBegin = 0, StepFill, StepAdvance, StepEnd, StepPost };
+
+    //! Box index of the tasks that act on a whole level.
+    constexpr int WholeLevel = -1;
+
+    TaskName StepName (int level, int step, int phase, int box = WholeLevel)
+    {
+        return TaskName(level, step, phase, box);
+    }
+
+    //! The advance of a box is the only task that runs on the threads of
+    //! the team.  All the others run on the master thread.
+    bool IsBoxAdvance (const TaskName& name)
+    {
+        return name[2] == StepAdvance && name[3] != WholeLevel;
+    }
+}
+
+//! One phase of one step of a level, or of one box of it.  Steps are
+//! numbered from 1 on each level within a coarse time step.
+class AmrStepTask final
+    : public Task
+{
+public:
+
+    AmrStepTask (AmrStepGraph& graph, int phase, int level, int step, int box, int parent_step,
+                 Real time, int iteration, int niter, Real stop_time)
+        : m_graph(graph), m_phase(phase), m_level(level), m_step(step), m_box(box),
+          m_parent_step(parent_step), m_time(time), m_iteration(iteration), m_niter(niter),
+          m_stop_time(stop_time)
+    {
+        SetName(StepName(level, step, phase, box));
+        if (!IsBoxAdvance(MyName())) {
+            SetMaster();
+        }
+    }
+
+    virtual bool Dependency () override { return m_num_pending == 0; }
+    virtual void Job () override;
+    virtual void PostCompletion () override;
+
+private:
+
+    friend class AmrStepGraph;
+
+    //! A task of the same step of this level.
+    AmrStepTask* makeTask (int phase, int box) const
+    {
+        return new AmrStepTask(m_graph, phase, m_level, m_step, box, m_parent_step,
+                               m_time, m_iteration, m_niter, m_stop_time);
+    }
+
+    AmrStepGraph& m_graph;
+    int  m_phase;
+    int  m_level;
+    int  m_step;
+    int  m_box;
+    int  m_parent_step;
+    Real m_time;
+    int  m_iteration;
+    int  m_niter;
+    Real m_stop_time;
+
+    //! Tasks that must finish before this one runs.
+    Vector<TaskName> m_inputs;
+    int m_num_pending = 0;
+
+    //! Order in which the task was added to the graph.
+    int m_seq = 0;
+};
+
+//! The tasks of one coarse time step and the order in which they run.
+class AmrStepGraph
+{
+public:
+
+    explicit AmrStepGraph (ScheduledAmr& amr)
+        : m_amr(amr), m_graph("AmrTimeStep"), m_num_steps(amr.maxLevel()+1, 0),
+          m_dt_new(amr.maxLevel()+1, 0.0)
+    {}
+
+    //! Adds a task whose m_inputs are set.
+    void add (AmrStepTask* t);
+
+    //! Runs the tasks until all have finished.  The box advances run on
+    //! the threads of an OpenMP team, everything else on the master thread.
+    void run ();
+
+    ScheduledAmr& amr () { return m_amr; }
+
+    //! Is the level advanced box by box?
+    AmrLevelBoxSteps* boxSteps (int level);
+
+    //! Inputs on the coarse level of the fill of a fine box, or of the
+    //! collective fill of a whole fine level.
+    void addCoarseInputs (AmrStepTask& t);
+
+    //! Starts count steps of a level, returning the number of the first.
+    int newSteps (int level, int count)
+    {
+        const int first = m_num_steps[level] + 1;
+        m_num_steps[level] += count;
+        return first;
+    }
+
+    //! New time step estimate of the last AmrLevel::advance of a level.
+    Real& dtNew (int level) { return m_dt_new[level]; }
+
+    int numTasks () const { return m_num_tasks; }
+    int maxReady () const { return m_max_ready; }
+
+private:
+
+    //! The loop of the master thread.
+    void runMaster ();
+
+    //! The loop of the other threads of the team, which run box advances
+    //! until the master is done.
+    void runWorker ();
+
+    //! The next task for the master thread, or nullptr.
+    AmrStepTask* nextMasterTask ();
+
+    //! Box advance from the shared queue, or nullptr.
+    AmrStepTask* popBoxTask ();
+
+    //! Releases the tasks waiting for t and adds the tasks it creates.
+    void finish (AmrStepTask* t);
+
+    //! Coarse boxes that the fill of fine box i of a level interpolates from.
+    void coarseBoxes (int level, int i, std::set<int>& cboxes);
+
+    ScheduledAmr& m_amr;
+    AbstractTaskGraph<Task> m_graph;
+    Vector<int> m_num_steps;
+    Vector<Real> m_dt_new;
+
+    // Only the master thread uses these.
+    std::set<TaskName> m_finished;
+    std::map<TaskName, Vector<AmrStepTask*> > m_waiting;
+    std::map<int, AmrStepTask*> m_master_tasks;
+    int m_num_live = 0;
+    int m_num_box_tasks = 0;
+    int m_num_added = 0;
+
+    // Shared with the threads of the team, in the critical section
+    // amrex_scheduledamr.
+    std::deque<AmrStepTask*> m_box_tasks;
+    Vector<AmrStepTask*> m_done;
+    bool m_stop = false;
+
+    int m_num_tasks = 0;
+    int m_max_ready = 0;
+};
+
+AmrLevelBoxSteps*
+AmrStepGraph::boxSteps (int level)
+{
+    return dynamic_cast<AmrLevelBoxSteps*>(m_amr.amr_level[level].get());
+}
+
+void
+AmrStepGraph::add (AmrStepTask* t)
+{
+    m_graph.GetTaskPool()[t->MyName()] = t;
+    ++m_num_live;
+    t->m_seq = m_num_added++;
+
+    t->m_num_pending = 0;
+    for (const TaskName& src : t->m_inputs)
+    {
+        if (m_finished.count(src) == 0) {
+            m_waiting[src].push_back(t);
+            ++t->m_num_pending;
+        }
+    }
+
+    if (t->isMasterTask()) {
+        m_master_tasks[t->m_seq] = t;
+    } else if (t->TestDependencies()) {
+        ++m_num_box_tasks;
+#ifdef _OPENMP
+#pragma omp critical (amrex_scheduledamr)
+#endif
+        m_box_tasks.push_back(t);
+    }
+}
+
+void
+AmrStepGraph::coarseBoxes (int level, int i, std::set<int>& cboxes)
+{
+    const int crse_level = level-1;
+
+    // The coarse region that the interpolation of the ghost cells reads.
+    const Box& fbx = amrex::grow(m_amr.amr_level[level]->boxArray()[i],
+                                 boxSteps(level)->fillPatchNGrow());
+    const IntVect& ratio = m_amr.refRatio(crse_level);
+    const DescriptorList& desc_lst = AmrLevel::get_desc_lst();
+    Box cbx = amrex::coarsen(fbx, ratio);
+    for (int k = 0; k < desc_lst.size(); ++k)
+    {
+        const StateDescriptor& desc = desc_lst[k];
+        for (int n = 0; n < desc.nComp(); ++n)
+        {
+            Interpolater* mapper = desc.interp(n);
+            if (mapper) {
+                cbx.minBox(mapper->CoarseBox(fbx, ratio));
+            }
+        }
+    }
+
+    const BoxArray& cba = m_amr.amr_level[crse_level]->boxArray();
+    const Geometry& cgeom = m_amr.Geom(crse_level);
+    Vector<IntVect> pshifts;
+    cgeom.periodicShift(cgeom.Domain(), cbx, pshifts);
+    pshifts.push_back(IntVect::TheZeroVector());
+
+    for (const IntVect& iv : pshifts)
+    {
+        for (const auto& is : cba.intersections(cbx+iv)) {
+            cboxes.insert(is.first);
+        }
+    }
+}
+
+void
+AmrStepGraph::addCoarseInputs (AmrStepTask& t)
+{
+    const int level = t.m_level;
+    const int crse_level = level-1;
+    const int parent_step = t.m_parent_step;
+
+    if (boxSteps(crse_level) == nullptr) {
+        t.m_inputs.push_back(StepName(crse_level, parent_step, StepAdvance));
+        return;
+    }
+
+    std::set<int> cboxes;
+    if (t.m_box == WholeLevel)
+    {
+        // The fill of a whole level is collective, so each process waits
+        // for its coarse boxes that any fine box reads.  The input on the
+        // coarse fill keeps the level tasks in the same order everywhere.
+        const int nboxes = m_amr.amr_level[level]->boxArray().size();
+        for (int i = 0; i < nboxes; ++i) {
+            coarseBoxes(level, i, cboxes);
+        }
+        t.m_inputs.push_back(StepName(crse_level, parent_step, StepFill));
+    }
+    else
+    {
+        coarseBoxes(level, t.m_box, cboxes);
+    }
+
+    const DistributionMapping& cdm = m_amr.amr_level[crse_level]->DistributionMap();
+    for (int i : cboxes) {
+        if (cdm[i] == ParallelDescriptor::MyProc()) {
+            t.m_inputs.push_back(StepName(crse_level, parent_step, StepAdvance, i));
+        }
+    }
+}
+
+AmrStepTask*
+AmrStepGraph::nextMasterTask ()
+{
+    // The fill of a single box only exists in runs with one process and
+    // can run as soon as it is ready.
+    for (const auto& kv : m_master_tasks)
+    {
+        AmrStepTask* t = kv.second;
+        if (t->m_box != WholeLevel && t->TestDependencies()) {
+            return t;
+        }
+    }
+
+    // The level tasks are collective, so every process runs them in the
+    // same order: the oldest one whose inputs on the master thread have
+    // finished, once its box inputs have finished too.  The inputs of the
+    // level tasks are set so that the box advances a level task waits for
+    // only need level tasks that have finished.
+    for (const auto& kv : m_master_tasks)
+    {
+        AmrStepTask* t = kv.second;
+        if (t->m_box != WholeLevel) continue;
+
+        bool eligible = true;
+        for (const TaskName& src : t->m_inputs)
+        {
+            if (!IsBoxAdvance(src) && m_finished.count(src) == 0) {
+                eligible = false;
+                break;
+            }
+        }
+        if (eligible) {
+            return t->TestDependencies() ? t : nullptr;
+        }
+    }
+    return nullptr;
+}
+
+AmrStepTask*
+AmrStepGraph::popBoxTask ()
+{
+    AmrStepTask* t = nullptr;
+#ifdef _OPENMP
+#pragma omp critical (amrex_scheduledamr)
+#endif
+    {
+        if (!m_box_tasks.empty()) {
+            t = m_box_tasks.front();
+            m_box_tasks.pop_front();
+        }
+    }
+    return t;
+}
+
+void
+AmrStepGraph::finish (AmrStepTask* t)
+{
+    ++m_num_tasks;
+    --m_num_live;
+    if (!t->isMasterTask()) {
+        --m_num_box_tasks;
+    }
+
+    const TaskName name = t->MyName();
+    m_finished.insert(name);
+    auto it = m_waiting.find(name);
+    if (it != m_waiting.end())
+    {
+        for (AmrStepTask* w : it->second)
+        {
+            if (--w->m_num_pending == 0 && !w->isMasterTask())
+            {
+                ++m_num_box_tasks;
+#ifdef _OPENMP
+#pragma omp critical (amrex_scheduledamr)
+#endif
+                m_box_tasks.push_back(w);
+            }
+        }
+        m_waiting.erase(it);
+    }
+
+    t->RunPostCompletion();
+
+    std::queue<Task*>& new_tasks = t->GetNewTasks();
+    while (!new_tasks.empty())
+    {
+        add(static_cast<AmrStepTask*>(new_tasks.front()));
+        new_tasks.pop();
+    }
+
+    if (!t->isPersistent()) {
+        m_graph.DestroyTask(t);
+        delete t;
+    }
+}
+
+void
+AmrStepGraph::runMaster ()
+{
+    while (m_num_live > 0)
+    {
+        Vector<AmrStepTask*> done;
+#ifdef _OPENMP
+#pragma omp critical (amrex_scheduledamr)
+#endif
+        std::swap(done, m_done);
+        for (AmrStepTask* t : done) {
+            finish(t);
+        }
+
+        m_max_ready = std::max(m_max_ready, m_num_box_tasks);
+
+        AmrStepTask* t = nextMasterTask();
+        if (t)
+        {
+            m_master_tasks.erase(t->m_seq);
+            t->RunJob();
+            finish(t);
+        }
+        else if ((t = popBoxTask()) != nullptr)
+        {
+            // Help the team while no task for the master is ready.
+            t->RunJob();
+            finish(t);
+        }
+        else if (m_num_box_tasks == 0 && done.empty())
+        {
+            amrex::Abort("ScheduledAmr::timeStep: no step task is ready");
+        }
+    }
+
+#ifdef _OPENMP
+#pragma omp critical (amrex_scheduledamr)
+#endif
+    m_stop = true;
+}
+
+void
+AmrStepGraph::runWorker ()
+{
+    for (;;)
+    {
+        AmrStepTask* t = nullptr;
+        bool stop = false;
+#ifdef _OPENMP
+#pragma omp critical (amrex_scheduledamr)
+#endif
+        {
+            stop = m_stop;
+            if (!m_box_tasks.empty()) {
+                t = m_box_tasks.front();
+                m_box_tasks.pop_front();
+            }
+        }
+
+        if (t)
+        {
+            t->RunJob();
+#ifdef _OPENMP
+#pragma omp critical (amrex_scheduledamr)
+#endif
+            m_done.push_back(t);
+        }
+        else if (stop)
+        {
+            break;
+        }
+    }
+}
+
+void
+AmrStepGraph::run ()
+{
+#ifdef _OPENMP
+    // Without box tasks the level functions keep all the threads.
+    bool use_team = false;
+    for (int lev = 0; lev <= m_amr.finestLevel(); ++lev) {
+        use_team = use_team || (boxSteps(lev) != nullptr);
+    }
+
+    if (use_team && omp_get_max_threads() > 1)
+    {
+#pragma omp parallel
+        {
+            if (omp_get_thread_num() == 0) {
+                runMaster();
+            } else {
+                runWorker();
+            }
+        }
+        return;
+    }
+#endif
+
+    runMaster();
+}
+
+void
+AmrStepTask::Job ()
+{
+    ScheduledAmr& amr = m_graph.amr();
+    AmrLevelBoxSteps* box_steps = m_graph.boxSteps(m_level);
+    const Real dt = amr.dt_level[m_level];
+
+    switch (m_phase)
+    {
+    case StepBegin:
+    {
+        // As in Amr::timeStep, the start of a substep is taken from the
+        // current dt of the level.
+        if (m_level > 0 && amr.sub_cycle) {
+            m_time += (m_iteration-1)*dt;
+        }
+
+        amr.timeStepPreAdvance(m_level, m_time, m_stop_time);
+
+        if (box_steps) {
+            box_steps->beginStep(m_time, amr.dt_level[m_level], m_iteration, m_niter);
+        }
+        break;
+    }
+    case StepFill:
+    {
+        if (m_box == WholeLevel) {
+            box_steps->fillPatchLevel(m_time);
+        } else {
+            box_steps->fillPatchBox(m_box, m_time);
+        }
+        break;
+    }
+    case StepAdvance:
+    {
+        if (box_steps) {
+            box_steps->advanceBox(m_box, m_time, dt, m_iteration, m_niter);
+        } else {
+            BL_PROFILE_REGION_START("amr_level.advance");
+            m_graph.dtNew(m_level) = amr.amr_level[m_level]->advance(m_time, dt, m_iteration, m_niter);
+            BL_PROFILE_REGION_STOP("amr_level.advance");
+        }
+        break;
+    }
+    case StepEnd:
+    {
+        Real dt_new = box_steps ? box_steps->endStep(m_time, dt, m_iteration, m_niter)
+                                : m_graph.dtNew(m_level);
+
+        // The finer steps were created at the begin of this step.
+        if (amr.amr_level[m_level]->postStepRegrid()) {
+            amrex::Abort("ScheduledAmr: post-step regrids need amr.use_task_graph = 0");
+        }
+
+        amr.timeStepPostAdvance(m_level, m_time, m_iteration, dt_new);
+        break;
+    }
+    case StepPost:
+    {
+        amr.amr_level[m_level]->post_timestep(m_iteration);
+
+        amr.which_level_being_advanced = -1;
+        break;
+    }
+    }
+}
+
+void
+AmrStepTask::PostCompletion ()
+{
+    if (m_phase == StepBegin)
+    {
+        // The grids of this level and the finer ones are now fixed until
+        // the next step of this level.
+        ScheduledAmr& amr = m_graph.amr();
+
+        AmrStepTask* end = makeTask(StepEnd, WholeLevel);
+        if (m_graph.boxSteps(m_level))
+        {
+            // With more than one process, a box fill cannot reach the data
+            // of other processes, so one collective task fills the boxes of
+            // the level and the advances of the local boxes wait for it.
+            AmrStepTask* fill_level = nullptr;
+            if (ParallelDescriptor::NProcs() > 1)
+            {
+                fill_level = makeTask(StepFill, WholeLevel);
+                fill_level->m_inputs.push_back(MyName());
+                if (m_level > 0) {
+                    m_graph.addCoarseInputs(*fill_level);
+                }
+                RegisterTask(fill_level);
+
+                end->m_inputs.push_back(fill_level->MyName());
+            }
+
+            const DistributionMapping& dm = amr.amr_level[m_level]->DistributionMap();
+            const int nboxes = amr.amr_level[m_level]->boxArray().size();
+            for (int i = 0; i < nboxes; ++i)
+            {
+                if (dm[i] != ParallelDescriptor::MyProc()) continue;
+
+                AmrStepTask* advance = makeTask(StepAdvance, i);
+                if (fill_level)
+                {
+                    advance->m_inputs.push_back(fill_level->MyName());
+                }
+                else
+                {
+                    AmrStepTask* fill = makeTask(StepFill, i);
+                    fill->m_inputs.push_back(MyName());
+                    if (m_level > 0) {
+                        m_graph.addCoarseInputs(*fill);
+                    }
+                    RegisterTask(fill);
+
+                    advance->m_inputs.push_back(fill->MyName());
+                }
+                RegisterTask(advance);
+
+                end->m_inputs.push_back(advance->MyName());
+            }
+        }
+        else
+        {
+            // AmrLevel::advance fills the whole level from the coarse level
+            // and adds to the flux registers.
+            AmrStepTask* advance = makeTask(StepAdvance, WholeLevel);
+            advance->m_inputs.push_back(MyName());
+            if (m_level > 0) {
+                advance->m_inputs.push_back(StepName(m_level-1, m_parent_step, StepEnd));
+            }
+            RegisterTask(advance);
+
+            end->m_inputs.push_back(advance->MyName());
+        }
+        if (m_level > 0) {
+            end->m_inputs.push_back(StepName(m_level-1, m_parent_step, StepEnd));
+        }
+        RegisterTask(end);
+
+        AmrStepTask* post = makeTask(StepPost, WholeLevel);
+        post->m_inputs.push_back(end->MyName());
+
+        if (m_level < amr.finest_level)
+        {
+            const int lev_fine = m_level+1;
+            const int nchildren = amr.sub_cycle ? amr.n_cycle[lev_fine] : 1;
+            const int first_child = m_graph.newSteps(lev_fine, nchildren);
+            for (int i = 0; i < nchildren; ++i)
+            {
+                AmrStepTask* child = new AmrStepTask(m_graph, StepBegin, lev_fine, first_child+i,
+                                                     WholeLevel, m_step, m_time, i+1, nchildren,
+                                                     m_stop_time);
+                child->m_inputs.push_back(MyName());
+                if (i > 0) {
+                    child->m_inputs.push_back(StepName(lev_fine, first_child+i-1, StepPost));
+                }
+                RegisterTask(child);
+
+                post->m_inputs.push_back(StepName(lev_fine, first_child+i, StepPost));
+            }
+        }
+        RegisterTask(post);
+    }
+    SelfDestroy();
+}
+
+ScheduledAmr::ScheduledAmr ()
+    : Amr()
+{
+    readParameters();
+}
+
+ScheduledAmr::ScheduledAmr (const RealBox* rb, int max_level_in, const Vector<int>& n_cell_in, int coord)
+    : Amr(rb, max_level_in, n_cell_in, coord)
+{
+    readParameters();
+}
+
+ScheduledAmr::~ScheduledAmr () {}
+
+void
+ScheduledAmr::readParameters ()
+{
+    ParmParse pp("amr");
+    pp.query("use_task_graph", use_task_graph);
+}
+
+void
+ScheduledAmr::timeStep (int  level,
+                        Real time,
+                        int  iteration,
+                        int  niter,
+                        Real stop_time)
+{
+    if (!use_task_graph || level > 0) {
+        Amr::timeStep(level, time, iteration, niter, stop_time);
+        return;
+    }
+
+    BL_PROFILE("ScheduledAmr::timeStep()");
+
+    AmrStepGraph graph(*this);
+
+    AmrStepTask* t = new AmrStepTask(graph, StepBegin, level, graph.newSteps(level, 1), WholeLevel,
+                                     0, time, iteration, niter, stop_time);
+    graph.add(t);
+    graph.run();
+
+    if (Verbose() > 1) {
+        amrex::Print() << "ScheduledAmr::timeStep: ran " << graph.numTasks() << " step tasks, at most "
+                       << graph.maxReady() << " box tasks ready at once\n";
+    }
+}
+
+}
@@ -89,6 +89,15 @@ FabSet::plusTo (MultiFab& dest, int ngrow, int scomp, int dcomp, int ncomp,
     dest.copy(m_mf,scomp,dcomp,ncomp,0,ngrow,period,FabArrayBase::ADD);
 }
 
+MultiFab::CopierHandle
+FabSet::plusTo_nowait (MultiFab& dest, int ngrow, int scomp, int dcomp, int ncomp,
+                       const Periodicity& period) const
+{
+    BL_ASSERT(boxArray() != dest.boxArray());
+    return dest.ParallelCopy_nowait(m_mf,scomp,dcomp,ncomp,IntVect(0),IntVect(ngrow),period,
+                                    FabArrayBase::ADD);
+}
+
 void
 FabSet::setVal (Real val)
 {
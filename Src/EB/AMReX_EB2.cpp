@@ -7,23 +7,33 @@
 #include <AMReX_EB2_IF_Sphere.H>
 #include <AMReX_EB2_IF_Torus.H>
 #include <AMReX_EB2_IF_Spline.H>
+#include <AMReX_EB2_IF_STL.H>
 #include <AMReX_EB2_GeometryShop.H>
 #include <AMReX_EB2.H>
 #include <AMReX_ParmParse.H>
 #include <AMReX.H>
 
+#include <cstdint>
+#include <cstdio>
+
 namespace amrex { namespace EB2 {
 
 Vector<std::unique_ptr<IndexSpace> > IndexSpace::m_instance;
 
 int max_grid_size = 64;
 bool compare_with_ch_eb = false;
+bool hierarchical_box_type = true;
+std::string cache_dir;
+std::string cache_key;
 
 void Initialize ()
 {
     ParmParse pp("eb2");
     pp.query("max_grid_size", max_grid_size);
     pp.query("compare_with_ch_eb", compare_with_ch_eb);
+    pp.query("hierarchical_box_type", hierarchical_box_type);
+    pp.query("cache_dir", cache_dir);
+    pp.query("cache_key", cache_key);
 
     amrex::ExecOnFinalize(Finalize);
 }
@@ -140,12 +150,86 @@ Build (const Geometry& geom, int required_coarsening_level,
         EB2::Build(gshop, geom, required_coarsening_level,
                    max_coarsening_level, ngrow);
     }
+#if (AMREX_SPACEDIM == 3)
+    else if (geom_type == "stl")
+    {
+        std::string filename;
+        pp.get("stl_file", filename);
+
+        Real scale = 1.0;
+        pp.query("stl_scale", scale);
+
+        RealArray center{0.0, 0.0, 0.0};
+        pp.query("stl_center", center);
+
+        bool has_fluid_inside;
+        pp.get("stl_has_fluid_inside", has_fluid_inside);
+
+        // Only the sign matters farther than a few cells from the surface.
+        const Real* dx = geom.CellSize();
+        Real band = 4.0*std::max({dx[0], dx[1], dx[2]});
+        pp.query("stl_band", band);
+
+        EB2::STLIF sf(filename, scale, center, has_fluid_inside, band);
+
+        EB2::GeometryShop<EB2::STLIF> gshop(sf);
+        EB2::Build(gshop, geom, required_coarsening_level,
+                   max_coarsening_level, ngrow);
+    }
+#endif
     else
     {
         amrex::Abort("geom_type "+geom_type+ " not supported");
     }
 }
 
+std::uint64_t
+hashBytes (const void* p, std::size_t n, std::uint64_t h)
+{
+    const unsigned char* c = static_cast<const unsigned char*>(p);
+    for (std::size_t i = 0; i < n; ++i) {
+        h = (h ^ c[i]) * 1099511628211ULL;
+    }
+    return h;
+}
+
+namespace {
+std::string to_hex (std::uint64_t h)
+{
+    char buf[17];
+    std::snprintf(buf, sizeof(buf), "%016llx", static_cast<unsigned long long>(h));
+    return std::string(buf);
+}
+}
+
+// Bump the version when the data of the levels change.
+std::string
+cacheKey (const Geometry& geom, int required_coarsening_level,
+          int max_coarsening_level, int ngrow,
+          const std::string& if_type, std::uint64_t if_hash)
+{
+    std::ostringstream os;
+    os.precision(17);
+    os << "EB2::IndexSpace cache version 2\n"
+       << AMREX_SPACEDIM << ' ' << sizeof(Real) << '\n'
+       << geom;
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        os << geom.isPeriodic(idim) << ' ';
+    }
+    os << '\n'
+       << required_coarsening_level << ' ' << max_coarsening_level << ' '
+       << ngrow << ' ' << EB2::max_grid_size << '\n'
+       << if_type << ' ' << to_hex(if_hash) << '\n'
+       << cache_key << '\n';
+    return os.str();
+}
+
+std::string
+cacheName (const std::string& key)
+{
+    return cache_dir + "/eb2_" + to_hex(hashBytes(key.data(), key.size()));
+}
+
 namespace {
 static int comp_max_crse_level (Box cdomain, const Box& domain)
 {
@@ -0,0 +1,471 @@
+
+#include <AMReX_EB2_IF_STL.H>
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_BLProfiler.H>
+#include <AMReX.H>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <cmath>
+
+namespace amrex { namespace EB2 {
+
+#if (AMREX_SPACEDIM == 3)
+
+namespace {
+
+using Triangle = Array<RealArray,3>;
+
+inline RealArray sub (const RealArray& a, const RealArray& b) {
+    return {a[0]-b[0], a[1]-b[1], a[2]-b[2]};
+}
+
+inline Real dot (const RealArray& a, const RealArray& b) {
+    return a[0]*b[0] + a[1]*b[1] + a[2]*b[2];
+}
+
+inline RealArray cross (const RealArray& a, const RealArray& b) {
+    return {a[1]*b[2]-a[2]*b[1], a[2]*b[0]-a[0]*b[2], a[0]*b[1]-a[1]*b[0]};
+}
+
+inline Real dist2 (const RealArray& a, const RealArray& b) {
+    const RealArray d = sub(a,b);
+    return dot(d,d);
+}
+
+// Squared distance from p to triangle abc (Ericson, Real-Time Collision
+// Detection, 5.1.5)
+Real dist2_triangle (const RealArray& p, const Triangle& t)
+{
+    const RealArray& a = t[0];
+    const RealArray& b = t[1];
+    const RealArray& c = t[2];
+    const RealArray ab = sub(b,a);
+    const RealArray ac = sub(c,a);
+
+    const RealArray ap = sub(p,a);
+    const Real d1 = dot(ab,ap);
+    const Real d2 = dot(ac,ap);
+    if (d1 <= 0.0 && d2 <= 0.0) return dot(ap,ap);
+
+    const RealArray bp = sub(p,b);
+    const Real d3 = dot(ab,bp);
+    const Real d4 = dot(ac,bp);
+    if (d3 >= 0.0 && d4 <= d3) return dot(bp,bp);
+
+    const Real vc = d1*d4 - d3*d2;
+    if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0) {
+        const Real v = d1/(d1-d3);
+        return dist2(p, {a[0]+v*ab[0], a[1]+v*ab[1], a[2]+v*ab[2]});
+    }
+
+    const RealArray cp = sub(p,c);
+    const Real d5 = dot(ab,cp);
+    const Real d6 = dot(ac,cp);
+    if (d6 >= 0.0 && d5 <= d6) return dot(cp,cp);
+
+    const Real vb = d5*d2 - d1*d6;
+    if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0) {
+        const Real w = d2/(d2-d6);
+        return dist2(p, {a[0]+w*ac[0], a[1]+w*ac[1], a[2]+w*ac[2]});
+    }
+
+    const Real va = d3*d6 - d5*d4;
+    if (va <= 0.0 && (d4-d3) >= 0.0 && (d5-d6) >= 0.0) {
+        const Real w = (d4-d3)/((d4-d3)+(d5-d6));
+        return dist2(p, {b[0]+w*(c[0]-b[0]), b[1]+w*(c[1]-b[1]), b[2]+w*(c[2]-b[2])});
+    }
+
+    const Real denom = 1.0/(va+vb+vc);
+    const Real v = vb*denom;
+    const Real w = vc*denom;
+    return dist2(p, {a[0]+ab[0]*v+ac[0]*w, a[1]+ab[1]*v+ac[1]*w, a[2]+ab[2]*v+ac[2]*w});
+}
+
+// Ray directions for the inside test.  They are not aligned with the
+// mesh, so that rays rarely hit edges or vertices of the triangles.
+const Real ray_dir[4][3] = {{ 0.7913,  0.5708,  0.2194},
+                            {-0.3307,  0.8602,  0.3882},
+                            { 0.1477, -0.3106,  0.9390},
+                            {-0.6533, -0.3552, -0.6686}};
+
+}
+
+struct STLIF::Tree
+{
+    // Leaves have count > 0 triangles starting at first.  Internal nodes
+    // have count = 0 and children first and first+1.
+    struct Node {
+        RealArray lo;
+        RealArray hi;
+        int first;
+        int count;
+    };
+
+    static constexpr int leaf_size = 4;
+    static constexpr int max_stack = 128;
+
+    Vector<Triangle> tri;
+    Vector<Node> node;
+    Real length_scale = 1.0;
+
+    void build ();
+    void fill (int inode, int begin, int end, Vector<int>& order,
+               const Vector<RealArray>& centroid);
+
+    Real distance2 (const RealArray& p, Real cutoff2) const;
+    bool touches (const RealArray& lo, const RealArray& hi, Real& dist2) const;
+    bool isInside (const RealArray& p) const;
+    int crossings (const RealArray& p, const RealArray& d, bool& degenerate) const;
+
+    static Real boxDistance2 (const Node& n, const RealArray& p) {
+        Real r = 0.0;
+        for (int i = 0; i < 3; ++i) {
+            const Real d = std::max(std::max(n.lo[i]-p[i], p[i]-n.hi[i]), 0.0);
+            r += d*d;
+        }
+        return r;
+    }
+
+    static Real boxDistance2 (const Node& n, const RealArray& lo, const RealArray& hi) {
+        Real r = 0.0;
+        for (int i = 0; i < 3; ++i) {
+            const Real d = std::max(std::max(n.lo[i]-hi[i], lo[i]-n.hi[i]), 0.0);
+            r += d*d;
+        }
+        return r;
+    }
+
+    static bool rayHitsBox (const Node& n, const RealArray& p, const RealArray& dinv) {
+        Real tmin = 0.0;
+        Real tmax = std::numeric_limits<Real>::max();
+        for (int i = 0; i < 3; ++i) {
+            Real t0 = (n.lo[i]-p[i])*dinv[i];
+            Real t1 = (n.hi[i]-p[i])*dinv[i];
+            if (t0 > t1) std::swap(t0,t1);
+            tmin = std::max(tmin,t0);
+            tmax = std::min(tmax,t1);
+        }
+        return tmin <= tmax;
+    }
+};
+
+void
+STLIF::Tree::build ()
+{
+    const int ntri = tri.size();
+    Vector<RealArray> centroid(ntri);
+    Vector<int> order(ntri);
+    for (int i = 0; i < ntri; ++i) {
+        for (int d = 0; d < 3; ++d) {
+            centroid[i][d] = (tri[i][0][d]+tri[i][1][d]+tri[i][2][d])*(1./3.);
+        }
+        order[i] = i;
+    }
+
+    node.reserve(2*(ntri/leaf_size+1));
+    node.resize(1);
+    fill(0, 0, ntri, order, centroid);
+
+    Vector<Triangle> sorted(ntri);
+    for (int i = 0; i < ntri; ++i) {
+        sorted[i] = tri[order[i]];
+    }
+    std::swap(tri, sorted);
+
+    length_scale = std::sqrt(dist2(node[0].lo, node[0].hi));
+}
+
+void
+STLIF::Tree::fill (int inode, int begin, int end, Vector<int>& order,
+                   const Vector<RealArray>& centroid)
+{
+    RealArray lo, hi, clo, chi;
+    for (int d = 0; d < 3; ++d) {
+        lo[d] = clo[d] =  std::numeric_limits<Real>::max();
+        hi[d] = chi[d] = std::numeric_limits<Real>::lowest();
+    }
+    for (int i = begin; i < end; ++i) {
+        const Triangle& t = tri[order[i]];
+        for (int d = 0; d < 3; ++d) {
+            lo[d] = std::min({lo[d], t[0][d], t[1][d], t[2][d]});
+            hi[d] = std::max({hi[d], t[0][d], t[1][d], t[2][d]});
+            clo[d] = std::min(clo[d], centroid[order[i]][d]);
+            chi[d] = std::max(chi[d], centroid[order[i]][d]);
+        }
+    }
+    node[inode].lo = lo;
+    node[inode].hi = hi;
+
+    if (end-begin <= leaf_size) {
+        node[inode].first = begin;
+        node[inode].count = end-begin;
+        return;
+    }
+
+    // Split at the median centroid in the longest direction.
+    int dir = 0;
+    for (int d = 1; d < 3; ++d) {
+        if (chi[d]-clo[d] > chi[dir]-clo[dir]) dir = d;
+    }
+    const int mid = (begin+end)/2;
+    std::nth_element(order.begin()+begin, order.begin()+mid, order.begin()+end,
+                     [&centroid,dir] (int a, int b) { return centroid[a][dir] < centroid[b][dir]; });
+
+    const int child = node.size();
+    node.resize(child+2);
+    node[inode].first = child;
+    node[inode].count = 0;
+    fill(child  , begin, mid, order, centroid);
+    fill(child+1, mid  , end, order, centroid);
+}
+
+// Squared distance from p to the surface, or cutoff2 if it is not less
+Real
+STLIF::Tree::distance2 (const RealArray& p, Real cutoff2) const
+{
+    Real best = cutoff2;
+    int stack[max_stack];
+    int top = 0;
+    stack[top++] = 0;
+    while (top > 0)
+    {
+        const Node& n = node[stack[--top]];
+        if (boxDistance2(n,p) >= best) continue;
+        if (n.count > 0) {
+            for (int i = n.first; i < n.first+n.count; ++i) {
+                best = std::min(best, dist2_triangle(p, tri[i]));
+            }
+        } else {
+            // Visit the nearer child first.
+            const Real d0 = boxDistance2(node[n.first  ], p);
+            const Real d1 = boxDistance2(node[n.first+1], p);
+            const int near = (d0 <= d1) ? n.first : n.first+1;
+            const int far  = (d0 <= d1) ? n.first+1 : n.first;
+            if (std::max(d0,d1) < best) stack[top++] = far;
+            if (std::min(d0,d1) < best) stack[top++] = near;
+        }
+    }
+    return best;
+}
+
+// Does any triangle bounding box touch [lo,hi]?  If not, dist2 is a
+// lower bound of the squared distance between the box and the surface.
+bool
+STLIF::Tree::touches (const RealArray& lo, const RealArray& hi, Real& dist2) const
+{
+    Real best = std::numeric_limits<Real>::max();
+    int stack[max_stack];
+    int top = 0;
+    stack[top++] = 0;
+    while (top > 0)
+    {
+        const Node& n = node[stack[--top]];
+        const Real d = boxDistance2(n,lo,hi);
+        if (d >= best) continue;
+        if (n.count > 0) {
+            if (d == 0.0) return true;
+            best = d;
+        } else {
+            stack[top++] = n.first;
+            stack[top++] = n.first+1;
+        }
+    }
+    dist2 = best;
+    return false;
+}
+
+int
+STLIF::Tree::crossings (const RealArray& p, const RealArray& d, bool& degenerate) const
+{
+    const Real eps = 1.e-10;
+    const Real teps = 1.e-12*length_scale;
+    const RealArray dinv{1.0/d[0], 1.0/d[1], 1.0/d[2]};
+
+    int count = 0;
+    int stack[max_stack];
+    int top = 0;
+    stack[top++] = 0;
+    while (top > 0)
+    {
+        const Node& n = node[stack[--top]];
+        if (!rayHitsBox(n,p,dinv)) continue;
+        if (n.count == 0) {
+            stack[top++] = n.first;
+            stack[top++] = n.first+1;
+            continue;
+        }
+        for (int i = n.first; i < n.first+n.count; ++i)
+        {
+            // Moller-Trumbore
+            const Triangle& t = tri[i];
+            const RealArray e1 = sub(t[1],t[0]);
+            const RealArray e2 = sub(t[2],t[0]);
+            const RealArray h = cross(d,e2);
+            const Real det = dot(e1,h);
+            if (det == 0.0) continue;
+            const Real f = 1.0/det;
+            const RealArray s = sub(p,t[0]);
+            const Real u = f*dot(s,h);
+            if (u < -eps || u > 1.0+eps) continue;
+            const RealArray q = cross(s,e1);
+            const Real v = f*dot(d,q);
+            if (v < -eps || u+v > 1.0+eps) continue;
+            const Real tt = f*dot(e2,q);
+            if (tt < -teps) continue;
+            if (u < eps || v < eps || u+v > 1.0-eps || tt < teps) {
+                degenerate = true;
+            } else {
+                ++count;
+            }
+        }
+    }
+    return count;
+}
+
+bool
+STLIF::Tree::isInside (const RealArray& p) const
+{
+    for (int i = 0; i < 3; ++i) {
+        if (p[i] < node[0].lo[i] || p[i] > node[0].hi[i]) return false;
+    }
+
+    // If a ray grazes an edge or a vertex, try another one.
+    int count = 0;
+    for (const auto& rd : ray_dir) {
+        bool degenerate = false;
+        count = crossings(p, {rd[0],rd[1],rd[2]}, degenerate);
+        if (!degenerate) break;
+    }
+    return count % 2 == 1;
+}
+
+STLIF::STLIF (const std::string& filename, Real scale, const RealArray& offset, bool inside,
+              Real band)
+    : m_sign(inside ? 1.0 : -1.0),
+      m_band(band)
+{
+    BL_PROFILE("EB2::STLIF()");
+
+    Vector<char> buf;
+    ParallelDescriptor::ReadAndBcastFile(filename, buf);
+    const std::size_t len = buf.size()-1;  // ReadAndBcastFile appends '\0'
+
+    std::shared_ptr<Tree> tree = std::make_shared<Tree>();
+    auto& tri = tree->tri;
+
+    auto add = [&tri, scale, &offset] (Triangle t) {
+        for (auto& v : t) {
+            for (int d = 0; d < 3; ++d) {
+                v[d] = scale*v[d] + offset[d];
+            }
+        }
+        const RealArray n = cross(sub(t[1],t[0]), sub(t[2],t[0]));
+        if (dot(n,n) > 0.0) tri.push_back(t);
+    };
+
+    std::uint32_t nbin = 0;
+    if (len >= 84) std::memcpy(&nbin, buf.dataPtr()+80, 4);
+
+    if (len >= 84 && len == 84 + 50*std::size_t(nbin))
+    {
+        // binary: 80 byte header, number of triangles, and for each
+        // triangle the normal, three vertices (float) and two bytes.
+        tri.reserve(nbin);
+        const char* p = buf.dataPtr()+84;
+        for (std::uint32_t i = 0; i < nbin; ++i, p += 50) {
+            float x[12];
+            std::memcpy(x, p, sizeof(x));
+            add({RealArray{x[3],x[ 4],x[ 5]},
+                 RealArray{x[6],x[ 7],x[ 8]},
+                 RealArray{x[9],x[10],x[11]}});
+        }
+    }
+    else if (len >= 5 && std::strncmp(buf.dataPtr(), "solid", 5) == 0)
+    {
+        // ASCII: we only need the vertices.
+        std::istringstream is(buf.dataPtr());
+        std::string word;
+        Triangle t;
+        int nv = 0;
+        while (is >> word) {
+            if (word == "vertex") {
+                RealArray& v = t[nv];
+                if (!(is >> v[0] >> v[1] >> v[2])) {
+                    amrex::Abort("STLIF: failed to read vertex in "+filename);
+                }
+                if (++nv == 3) {
+                    add(t);
+                    nv = 0;
+                }
+            }
+        }
+    }
+    else
+    {
+        amrex::Abort("STLIF: "+filename+" is not an STL file");
+    }
+
+    if (tri.empty()) {
+        amrex::Abort("STLIF: no triangles in "+filename);
+    }
+
+    tree->build();
+    m_tree = tree;
+}
+
+Real
+STLIF::operator() (const RealArray& p) const
+{
+    const Real band2 = (m_band < std::sqrt(std::numeric_limits<Real>::max()))
+        ? m_band*m_band : std::numeric_limits<Real>::max();
+    const Real d2 = m_tree->distance2(p, band2);
+    if (d2 == 0.0) return 0.0;
+    const Real d = (d2 < band2) ? std::sqrt(d2) : m_band;
+    return m_tree->isInside(p) ? -m_sign*d : m_sign*d;
+}
+
+Interval
+STLIF::range (const RealArray& lo, const RealArray& hi) const
+{
+    Real d2;
+    if (m_tree->touches(lo, hi, d2)) return Interval::everything();
+
+    // The box is on one side of the surface.  Any vertex is at least as
+    // far as the surface.
+    const RealArray& v = m_tree->tri[0][0];
+    Real dmax2 = 0.0;
+    for (int i = 0; i < 3; ++i) {
+        const Real d = std::max(std::abs(lo[i]-v[i]), std::abs(hi[i]-v[i]));
+        dmax2 += d*d;
+    }
+    const Real dmin = std::min(std::sqrt(d2), m_band);
+    const Real dmax = std::min(std::sqrt(dmax2), m_band);
+
+    const RealArray center{0.5*(lo[0]+hi[0]), 0.5*(lo[1]+hi[1]), 0.5*(lo[2]+hi[2])};
+    if (m_tree->isInside(center)) {
+        return m_sign*Interval{-dmax, -dmin};
+    } else {
+        return m_sign*Interval{dmin, dmax};
+    }
+}
+
+int
+STLIF::numTriangles () const
+{
+    return m_tree->tri.size();
+}
+
+void
+STLIF::boundingBox (RealArray& lo, RealArray& hi) const
+{
+    lo = m_tree->node[0].lo;
+    hi = m_tree->node[0].hi;
+}
+
+#endif
+
+}}
@@ -1,7 +1,10 @@
 
 #include <AMReX_EB2_Level.H>
 #include <AMReX_IArrayBox.H>
+#include <AMReX_Utility.H>
 #include <algorithm>
+#include <fstream>
+#include <sstream>
 
 namespace amrex { namespace EB2 {
 
@@ -665,4 +668,141 @@ Level::fillLevelSet (MultiFab& levelset, const Geometry& geom) const
     }
 }
         
+void
+Level::write (const std::string& dirname) const
+{
+    BL_PROFILE("EB2::Level::write()");
+
+    if (ParallelDescriptor::IOProcessor())
+    {
+        if ( ! amrex::UtilCreateDirectory(dirname, 0755)) {
+            amrex::CreateDirectoryFailed(dirname);
+        }
+
+        const std::string HeaderFileName = dirname + "/Header";
+        std::ofstream HeaderFile(HeaderFileName.c_str(), std::ios::out | std::ios::trunc |
+                                                         std::ios::binary);
+        if ( ! HeaderFile.good()) {
+            amrex::FileOpenFailed(HeaderFileName);
+        }
+        HeaderFile << m_geom.Domain() << '\n' << m_allregular << '\n';
+        if (!m_allregular) {
+            HeaderFile << m_ngrow << '\n' << m_levelset.nGrow() << '\n';
+            m_grids.writeOn(HeaderFile);
+            HeaderFile << '\n' << !m_covered_grids.empty() << '\n';
+            if (!m_covered_grids.empty()) {
+                m_covered_grids.writeOn(HeaderFile);
+                HeaderFile << '\n';
+            }
+        }
+        if ( ! HeaderFile.good()) {
+            amrex::Error("EB2::Level::write() failed");
+        }
+    }
+    ParallelDescriptor::Barrier("EB2::Level::write");
+
+    if (m_allregular) return;
+
+    // The flags are 32-bit integers, which are exact as Real.
+    MultiFab cellflag(m_grids, m_dmap, 1, m_cellflag.nGrow());
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(cellflag); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.fabbox();
+        const auto& src = m_cellflag[mfi];
+        auto& dst = cellflag[mfi];
+        for (BoxIterator bi(bx); bi.ok(); ++bi) {
+            dst(bi()) = src(bi()).getValue();
+        }
+    }
+
+    VisMF::Write(cellflag, dirname+"/CellFlag");
+    VisMF::Write(m_levelset, dirname+"/LevelSet");
+    VisMF::Write(m_volfrac, dirname+"/VolFrac");
+    VisMF::Write(m_centroid, dirname+"/Centroid");
+    VisMF::Write(m_bndryarea, dirname+"/BndryArea");
+    VisMF::Write(m_bndrycent, dirname+"/BndryCent");
+    VisMF::Write(m_bndrynorm, dirname+"/BndryNorm");
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        VisMF::Write(m_areafrac[idim], dirname+"/AreaFrac_"+std::to_string(idim));
+        VisMF::Write(m_facecent[idim], dirname+"/FaceCent_"+std::to_string(idim));
+    }
+}
+
+void
+Level::read (const std::string& dirname)
+{
+    BL_PROFILE("EB2::Level::read()");
+
+    Vector<char> fileCharPtr;
+    ParallelDescriptor::ReadAndBcastFile(dirname + "/Header", fileCharPtr);
+    std::istringstream is(std::string(fileCharPtr.dataPtr()), std::istringstream::in);
+
+    // m_ok stays false if the data are not for the domain of this level.
+    Box domain;
+    is >> domain >> m_allregular;
+    if (!is || domain != m_geom.Domain()) return;
+    if (m_allregular) {
+        m_ok = true;
+        return;
+    }
+
+    int ng_levelset;
+    is >> m_ngrow >> ng_levelset;
+    m_grids.readFrom(is);
+    bool has_covered_grids;
+    is >> has_covered_grids;
+    if (has_covered_grids) {
+        m_covered_grids.readFrom(is);
+    }
+    if (!is || !amrex::grow(domain,m_ngrow).contains(m_grids.minimalBox())) return;
+
+    // The DistributionMapping may differ from the one of the writer.
+    // Each process reads its own fabs.
+    m_dmap = DistributionMapping(m_grids);
+
+    const int ng = 2;
+    MultiFab cellflag(m_grids, m_dmap, 1, ng);
+    VisMF::Read(cellflag, dirname+"/CellFlag");
+    m_cellflag.define(m_grids, m_dmap, 1, ng);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(cellflag); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.fabbox();
+        const auto& src = cellflag[mfi];
+        auto& dst = m_cellflag[mfi];
+        for (BoxIterator bi(bx); bi.ok(); ++bi) {
+            dst(bi()) = static_cast<uint32_t>(src(bi()));
+        }
+    }
+
+    m_levelset.define(amrex::convert(m_grids,IntVect::TheNodeVector()), m_dmap, 1, ng_levelset);
+    VisMF::Read(m_levelset, dirname+"/LevelSet");
+
+    m_volfrac.define(m_grids, m_dmap, 1, ng);
+    VisMF::Read(m_volfrac, dirname+"/VolFrac");
+    m_centroid.define(m_grids, m_dmap, AMREX_SPACEDIM, ng);
+    VisMF::Read(m_centroid, dirname+"/Centroid");
+    m_bndryarea.define(m_grids, m_dmap, 1, ng);
+    VisMF::Read(m_bndryarea, dirname+"/BndryArea");
+    m_bndrycent.define(m_grids, m_dmap, AMREX_SPACEDIM, ng);
+    VisMF::Read(m_bndrycent, dirname+"/BndryCent");
+    m_bndrynorm.define(m_grids, m_dmap, AMREX_SPACEDIM, ng);
+    VisMF::Read(m_bndrynorm, dirname+"/BndryNorm");
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        m_areafrac[idim].define(amrex::convert(m_grids, IntVect::TheDimensionVector(idim)),
+                                m_dmap, 1, ng);
+        VisMF::Read(m_areafrac[idim], dirname+"/AreaFrac_"+std::to_string(idim));
+        m_facecent[idim].define(amrex::convert(m_grids, IntVect::TheDimensionVector(idim)),
+                                m_dmap, AMREX_SPACEDIM-1, ng);
+        VisMF::Read(m_facecent[idim], dirname+"/FaceCent_"+std::to_string(idim));
+    }
+
+    m_ok = true;
+}
+
 }}
@@ -3,6 +3,10 @@
 #include <AMReX_EBAmrUtil_F.H>
 #include <AMReX_EBFArrayBox.H>
 #include <AMReX_EBCellFlag.H>
+#include <AMReX_EB2.H>
+#include <AMReX_ParmParse.H>
+
+#include <cmath>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -40,4 +44,199 @@ TagCutCells (TagBoxArray& tags, const MultiFab& state)
     }
 }
 
+namespace {
+    bool eb_costs_initialized = false;
+    EBCellCosts eb_costs;
+}
+
+EBCellCosts
+EBGetCellCosts ()
+{
+    if (!eb_costs_initialized)
+    {
+        ParmParse pp("eb2");
+        pp.query("cost_regular", eb_costs.regular);
+        pp.query("cost_cut"    , eb_costs.cut);
+        pp.query("cost_covered", eb_costs.covered);
+        eb_costs_initialized = true;
+    }
+    return eb_costs;
+}
+
+void
+EBSetCellCosts (const EBCellCosts& costs)
+{
+    eb_costs = costs;
+    eb_costs_initialized = true;
+}
+
+void
+EBCellCostWeights (MultiFab& weight, const FabArray<EBCellFlagFab>& flags,
+                   const EBCellCosts& costs)
+{
+    BL_PROFILE("EBCellCostWeights()");
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(weight, true); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+        const auto& flag = flags[mfi];
+        FArrayBox& wfab = weight[mfi];
+
+        const FabType typ = flag.getType(bx);
+        if (typ == FabType::regular) {
+            wfab.setVal(costs.regular, bx, 0, 1);
+        } else if (typ == FabType::covered) {
+            wfab.setVal(costs.covered, bx, 0, 1);
+        } else {
+            amrex_eb_cell_costs(BL_TO_FORTRAN_BOX(bx),
+                                BL_TO_FORTRAN_ANYD(wfab),
+                                BL_TO_FORTRAN_ANYD(flag),
+                                costs.regular, costs.cut, costs.covered);
+        }
+    }
+}
+
+void
+EBCountCells (LayoutData<Array<long,3> >& counts, const FabArray<EBCellFlagFab>& flags)
+{
+    BL_PROFILE("EBCountCells()");
+
+    counts.define(flags.boxArray(), flags.DistributionMap());
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(flags); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.validbox();
+        const auto& flag = flags[mfi];
+        Array<long,3>& n = counts[mfi];
+        n = {0L, 0L, 0L};
+
+        const FabType typ = flag.getType(bx);
+        if (typ == FabType::regular) {
+            n[0] = bx.numPts();
+        } else if (typ == FabType::covered) {
+            n[2] = bx.numPts();
+        } else {
+            int nreg = 0, ncut = 0, ncov = 0;
+            amrex_eb_count_cells(BL_TO_FORTRAN_BOX(bx),
+                                 BL_TO_FORTRAN_ANYD(flag),
+                                 &nreg, &ncut, &ncov);
+            n = {long(nreg), long(ncut), long(ncov)};
+        }
+    }
+}
+
+EBCellCosts
+EBFitCellCosts (const FabArray<EBCellFlagFab>& flags, const LayoutData<Real>& box_time)
+{
+    BL_PROFILE("EBFitCellCosts()");
+
+    const EBCellCosts current = EBGetCellCosts();
+
+    LayoutData<Array<long,3> > counts;
+    EBCountCells(counts, flags);
+
+    // Normal equations a c = b of min sum_boxes (n.c - t)^2, with the
+    // counts n scaled by the box size to keep a well conditioned.
+    Vector<Real> ab(12, 0.0);
+    for (MFIter mfi(flags); mfi.isValid(); ++mfi)
+    {
+        const Array<long,3>& n = counts[mfi];
+        const Real scale = 1.0/mfi.validbox().numPts();
+        const Real x[3] = {n[0]*scale, n[1]*scale, n[2]*scale};
+        const Real t = box_time[mfi]*scale;
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                ab[3*i+j] += x[i]*x[j];
+            }
+            ab[9+i] += x[i]*t;
+        }
+    }
+    ParallelAllReduce::Sum(ab.data(), ab.size(), ParallelContext::CommunicatorSub());
+
+    // Only solve for the cell types that are present.
+    int idx[3];
+    int m = 0;
+    for (int i = 0; i < 3; ++i) {
+        if (ab[3*i+i] > 0.0) idx[m++] = i;
+    }
+    if (m == 0 || idx[0] != 0) return current;
+
+    Real a[3][4];
+    Real amax = 0.0;
+    for (int i = 0; i < m; ++i) {
+        for (int j = 0; j < m; ++j) {
+            a[i][j] = ab[3*idx[i]+idx[j]];
+        }
+        a[i][m] = ab[9+idx[i]];
+        amax = std::max(amax, a[i][i]);
+    }
+
+    for (int k = 0; k < m; ++k)
+    {
+        int p = k;
+        for (int i = k+1; i < m; ++i) {
+            if (std::abs(a[i][k]) > std::abs(a[p][k])) p = i;
+        }
+        if (std::abs(a[p][k]) <= 1.e-12*amax) return current;
+        for (int j = 0; j <= m; ++j) std::swap(a[k][j], a[p][j]);
+        for (int i = k+1; i < m; ++i) {
+            const Real f = a[i][k]/a[k][k];
+            for (int j = k; j <= m; ++j) a[i][j] -= f*a[k][j];
+        }
+    }
+
+    Real c[3];
+    for (int k = m-1; k >= 0; --k) {
+        Real s = a[k][m];
+        for (int j = k+1; j < m; ++j) s -= a[k][j]*c[j];
+        c[k] = s/a[k][k];
+    }
+
+    if (c[0] <= 0.0) return current;
+
+    // Types that are absent keep their current cost relative to regular cells.
+    EBCellCosts r;
+    r.regular = 1.0;
+    r.cut     = current.cut/current.regular;
+    r.covered = current.covered/current.regular;
+    for (int k = 1; k < m; ++k) {
+        const Real v = std::max(c[k]/c[0], 0.0);
+        if (idx[k] == 1) {
+            r.cut = v;
+        } else {
+            r.covered = v;
+        }
+    }
+    return r;
+}
+
+bool
+EBHasLevel (const Geometry& geom)
+{
+    return !EB2::IndexSpace::empty() && EB2::IndexSpace::top().hasLevel(geom);
+}
+
+DistributionMapping
+EBMakeLoadBalanceDistributionMap (const BoxArray& ba, const Geometry& geom,
+                                  const EBCellCosts& costs, int nmax)
+{
+    BL_PROFILE("EBMakeLoadBalanceDistributionMap()");
+
+    const DistributionMapping dm(ba);
+
+    FabArray<EBCellFlagFab> flags(ba, dm, 1, 0);
+    EB2::IndexSpace::top().getLevel(geom).fillEBCellFlag(flags, geom);
+
+    MultiFab weight(ba, dm, 1, 0);
+    EBCellCostWeights(weight, flags, costs);
+
+    return DistributionMapping::makeKnapSack(weight, nmax);
+}
+
 }
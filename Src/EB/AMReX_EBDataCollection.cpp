@@ -2,6 +2,7 @@
 #include <AMReX_EBDataCollection.H>
 #include <AMReX_MultiFab.H>
 #include <AMReX_MultiCutFab.H>
+#include <AMReX_SparseCutFab.H>
 
 #include <AMReX_EB2_Level.H>
 
@@ -19,6 +20,11 @@ EBDataCollection::EBDataCollection (const EB2::Level& a_level,
     // The BoxArray argument may not be cell-centered BoxArray.
     const BoxArray& a_ba = amrex::convert(a_ba_in, IntVect::TheZeroVector());
 
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        m_dense_areafrac[idim].store(nullptr);
+        m_dense_facecent[idim].store(nullptr);
+    }
+
     if (m_support >= EBSupport::basic)
     {
         m_cellflags = new FabArray<EBCellFlagFab>(a_ba, a_dm, 1, m_ngrow[0], MFInfo(),
@@ -31,31 +37,54 @@ EBDataCollection::EBDataCollection (const EB2::Level& a_level,
         m_volfrac = new MultiFab(a_ba, a_dm, 1, m_ngrow[1], MFInfo(), FArrayBoxFactory());
         a_level.fillVolFrac(*m_volfrac, m_geom);
 
-        m_centroid = new MultiCutFab(a_ba, a_dm, AMREX_SPACEDIM, m_ngrow[1], *m_cellflags);
-        a_level.fillCentroid(*m_centroid, m_geom);
+        MultiCutFab centroid(a_ba, a_dm, AMREX_SPACEDIM, m_ngrow[1], *m_cellflags);
+        a_level.fillCentroid(centroid, m_geom);
+        m_centroid = new MultiSparseCutFab(centroid, *m_cellflags, 0.0, 0.0);
     }
 
     if (m_support == EBSupport::full)
     {
         const int ng = m_ngrow[2];
 
-        m_bndrycent = new MultiCutFab(a_ba, a_dm, AMREX_SPACEDIM, ng, *m_cellflags);
-        a_level.fillBndryCent(*m_bndrycent, m_geom);
+        {
+            MultiCutFab bndrycent(a_ba, a_dm, AMREX_SPACEDIM, ng, *m_cellflags);
+            a_level.fillBndryCent(bndrycent, m_geom);
+            m_bndrycent = new MultiSparseCutFab(bndrycent, *m_cellflags, -1.0, -1.0);
+        }
+
+        {
+            MultiCutFab bndryarea(a_ba, a_dm, 1, ng, *m_cellflags);
+            a_level.fillBndryArea(bndryarea, m_geom);
+            m_bndryarea = new MultiSparseCutFab(bndryarea, *m_cellflags, 0.0, 0.0);
+        }
 
-        m_bndryarea = new MultiCutFab(a_ba, a_dm, 1, ng, *m_cellflags);
-        a_level.fillBndryArea(*m_bndryarea, m_geom);
+        {
+            MultiCutFab bndrynorm(a_ba, a_dm, AMREX_SPACEDIM, ng, *m_cellflags);
+            a_level.fillBndryNorm(bndrynorm, m_geom);
+            m_bndrynorm = new MultiSparseCutFab(bndrynorm, *m_cellflags, 0.0, 0.0);
+        }
 
-        m_bndrynorm = new MultiCutFab(a_ba, a_dm, AMREX_SPACEDIM, ng, *m_cellflags);
-        a_level.fillBndryNorm(*m_bndrynorm, m_geom);
+        Array<MultiCutFab*,AMREX_SPACEDIM> facedata;
 
         for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
             const BoxArray& faceba = amrex::convert(a_ba, IntVect::TheDimensionVector(idim));
-            m_areafrac[idim] = new MultiCutFab(faceba, a_dm, 1, ng, *m_cellflags);
-            m_facecent[idim] = new MultiCutFab(faceba, a_dm, AMREX_SPACEDIM-1, ng, *m_cellflags);
+            facedata[idim] = new MultiCutFab(faceba, a_dm, 1, ng, *m_cellflags);
+        }
+        a_level.fillAreaFrac(facedata, m_geom);
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            m_areafrac[idim] = new MultiSparseCutFab(*facedata[idim], *m_cellflags, 1.0, 0.0);
+            delete facedata[idim];
         }
 
-        a_level.fillAreaFrac(m_areafrac, m_geom);
-        a_level.fillFaceCent(m_facecent, m_geom);
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            const BoxArray& faceba = amrex::convert(a_ba, IntVect::TheDimensionVector(idim));
+            facedata[idim] = new MultiCutFab(faceba, a_dm, AMREX_SPACEDIM-1, ng, *m_cellflags);
+        }
+        a_level.fillFaceCent(facedata, m_geom);
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            m_facecent[idim] = new MultiSparseCutFab(*facedata[idim], *m_cellflags, 0.0, 0.0);
+            delete facedata[idim];
+        }
     }
 }
 
@@ -71,6 +100,14 @@ EBDataCollection::~EBDataCollection ()
         delete m_areafrac[idim];
         delete m_facecent[idim];
     }
+    delete m_dense_centroid.load();
+    delete m_dense_bndrycent.load();
+    delete m_dense_bndrynorm.load();
+    delete m_dense_bndryarea.load();
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        delete m_dense_areafrac[idim].load();
+        delete m_dense_facecent[idim].load();
+    }
 }
 
 const FabArray<EBCellFlagFab>&
@@ -91,42 +128,114 @@ const MultiCutFab&
 EBDataCollection::getCentroid () const
 {
     AMREX_ASSERT(m_centroid != nullptr);
-    return *m_centroid;
+    return makeDense(m_dense_centroid, *m_centroid);
 }
 
 const MultiCutFab&
 EBDataCollection::getBndryCent () const
 {
     AMREX_ASSERT(m_bndrycent != nullptr);
-    return *m_bndrycent;
+    return makeDense(m_dense_bndrycent, *m_bndrycent);
 }
 
 const MultiCutFab&
 EBDataCollection::getBndryArea () const
 {
     AMREX_ASSERT(m_bndryarea != nullptr);
-    return *m_bndryarea;
+    return makeDense(m_dense_bndryarea, *m_bndryarea);
 }
 
 Array<const MultiCutFab*, AMREX_SPACEDIM>
 EBDataCollection::getAreaFrac () const
 {
     AMREX_ASSERT(m_areafrac[0] != nullptr);
-    return {AMREX_D_DECL(m_areafrac[0], m_areafrac[1], m_areafrac[2])};
+    return {AMREX_D_DECL(&makeDense(m_dense_areafrac[0], *m_areafrac[0]),
+                         &makeDense(m_dense_areafrac[1], *m_areafrac[1]),
+                         &makeDense(m_dense_areafrac[2], *m_areafrac[2]))};
 }
 
 Array<const MultiCutFab*, AMREX_SPACEDIM>
 EBDataCollection::getFaceCent () const
 {
     AMREX_ASSERT(m_facecent[0] != nullptr);
-    return {AMREX_D_DECL(m_facecent[0], m_facecent[1], m_facecent[2])};
+    return {AMREX_D_DECL(&makeDense(m_dense_facecent[0], *m_facecent[0]),
+                         &makeDense(m_dense_facecent[1], *m_facecent[1]),
+                         &makeDense(m_dense_facecent[2], *m_facecent[2]))};
 }
 
 const MultiCutFab&
 EBDataCollection::getBndryNormal () const
+{
+    AMREX_ASSERT(m_bndrynorm != nullptr);
+    return makeDense(m_dense_bndrynorm, *m_bndrynorm);
+}
+
+const MultiSparseCutFab&
+EBDataCollection::getSparseCentroid () const
+{
+    AMREX_ASSERT(m_centroid != nullptr);
+    return *m_centroid;
+}
+
+const MultiSparseCutFab&
+EBDataCollection::getSparseBndryCent () const
+{
+    AMREX_ASSERT(m_bndrycent != nullptr);
+    return *m_bndrycent;
+}
+
+const MultiSparseCutFab&
+EBDataCollection::getSparseBndryArea () const
+{
+    AMREX_ASSERT(m_bndryarea != nullptr);
+    return *m_bndryarea;
+}
+
+const MultiSparseCutFab&
+EBDataCollection::getSparseBndryNormal () const
 {
     AMREX_ASSERT(m_bndrynorm != nullptr);
     return *m_bndrynorm;
 }
 
+Array<const MultiSparseCutFab*, AMREX_SPACEDIM>
+EBDataCollection::getSparseAreaFrac () const
+{
+    AMREX_ASSERT(m_areafrac[0] != nullptr);
+    return {AMREX_D_DECL(m_areafrac[0], m_areafrac[1], m_areafrac[2])};
+}
+
+Array<const MultiSparseCutFab*, AMREX_SPACEDIM>
+EBDataCollection::getSparseFaceCent () const
+{
+    AMREX_ASSERT(m_facecent[0] != nullptr);
+    return {AMREX_D_DECL(m_facecent[0], m_facecent[1], m_facecent[2])};
+}
+
+const MultiCutFab&
+EBDataCollection::makeDense (std::atomic<MultiCutFab*>& dense,
+                             const MultiSparseCutFab& sparse) const
+{
+    // Only the call that makes the dense data takes the lock.  Once it
+    // is published, the getters are a single acquire load.
+    MultiCutFab* p = dense.load(std::memory_order_acquire);
+    if (p == nullptr)
+    {
+#ifdef _OPENMP
+#pragma omp critical (amrex_ebdc_make_dense)
+#endif
+        {
+            p = dense.load(std::memory_order_relaxed);
+            if (p == nullptr)
+            {
+                p = new MultiCutFab(sparse.boxArray(), sparse.DistributionMap(),
+                                    sparse.nComp(), sparse.nGrow(), *m_cellflags);
+                sparse.copyTo(*p);
+                dense.store(p, std::memory_order_release);
+            }
+        }
+    }
+    return *p;
+}
+
 }
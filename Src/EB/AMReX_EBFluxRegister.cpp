@@ -191,6 +191,52 @@ EBFluxRegister::FineAdd (const MFIter& mfi,
 }
 
 
+void
+EBFluxRegister::CrseAdd (const MFIter& mfi,
+                         const std::array<FArrayBox const*, AMREX_SPACEDIM>& flux,
+                         const Real* dx, Real dt,
+                         const FArrayBox& volfrac,
+                         const std::array<SparseCutFab const*, AMREX_SPACEDIM>& areafrac,
+                         const EBCellFlagFab& flags)
+{
+    if (m_crse_fab_flag[mfi.LocalIndex()] == crse_cell) {
+        return;  // this coarse fab is not close to fine fabs.
+    }
+
+    const Box& bx = mfi.tilebox();
+    std::array<FArrayBox,AMREX_SPACEDIM> atmp;
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        const Box& b = amrex::surroundingNodes(bx,idim) & areafrac[idim]->box();
+        atmp[idim].resize(b,1);
+        areafrac[idim]->copyTo(atmp[idim], b, flags);
+    }
+
+    CrseAdd(mfi, flux, dx, dt, volfrac, {AMREX_D_DECL(&atmp[0],&atmp[1],&atmp[2])});
+}
+
+void
+EBFluxRegister::FineAdd (const MFIter& mfi,
+                         const std::array<FArrayBox const*, AMREX_SPACEDIM>& flux,
+                         const Real* dx, Real dt,
+                         const FArrayBox& volfrac,
+                         const std::array<SparseCutFab const*, AMREX_SPACEDIM>& areafrac,
+                         const EBCellFlagFab& flags,
+                         const FArrayBox& dm)
+{
+    if (m_cfp_fab[mfi.LocalIndex()].empty()) return;
+
+    const Box& fbx = amrex::refine(amrex::coarsen(mfi.tilebox(), m_ratio), m_ratio);
+    std::array<FArrayBox,AMREX_SPACEDIM> atmp;
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        const Box& b = amrex::surroundingNodes(fbx,idim) & areafrac[idim]->box();
+        atmp[idim].resize(b,1);
+        areafrac[idim]->copyTo(atmp[idim], b, flags);
+    }
+
+    FineAdd(mfi, flux, dx, dt, volfrac, {AMREX_D_DECL(&atmp[0],&atmp[1],&atmp[2])}, dm);
+}
+
+
 void
 EBFluxRegister::Reflux (MultiFab& crse_state, const amrex::MultiFab& crse_vfrac,
                         MultiFab& fine_state, const amrex::MultiFab& fine_vfrac)
@@ -7,6 +7,7 @@
 #include <AMReX_MultiFabUtil_C.H>
 #include <AMReX_EBCellFlag.H>
 #include <AMReX_MultiCutFab.H>
+#include <AMReX_SparseCutFab.H>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -55,12 +56,14 @@ EB_set_covered_faces (const Array<MultiFab*,AMREX_SPACEDIM>& umac, Real val)
     const auto factory = dynamic_cast<EBFArrayBoxFactory const*>(&(umac[0]->Factory()));
     if (factory == nullptr) return;
 
-    const auto& area = factory->getAreaFrac();
+    const auto& area = factory->getSparseAreaFrac();
     const auto& flags = factory->getMultiEBCellFlagFab();
 
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
+    {
+    FArrayBox areafab;
     for (MFIter mfi(*umac[0],true); mfi.isValid(); ++mfi)
     {
         for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
@@ -70,12 +73,14 @@ EB_set_covered_faces (const Array<MultiFab*,AMREX_SPACEDIM>& umac, Real val)
             if (fabtyp == FabType::covered) {
                 (*umac[idim])[mfi].setVal(0.0, bx, 0, 1);
             } else if (fabtyp != FabType::regular) {
+                (*area[idim])[mfi].toFab(areafab, bx, flags[mfi]);
                 amrex_eb_set_covered_faces(BL_TO_FORTRAN_BOX(bx),
                                            BL_TO_FORTRAN_ANYD((*umac[idim])[mfi]),
-                                           BL_TO_FORTRAN_ANYD((*area[idim])[mfi]));
+                                           BL_TO_FORTRAN_ANYD(areafab));
             }
         }
     }
+    }
 }
 
 void
@@ -252,13 +257,15 @@ void EB_average_down_faces (const Array<const MultiFab*,AMREX_SPACEDIM>& fine,
     else 
     {
         const auto& factory = dynamic_cast<EBFArrayBoxFactory const&>((*fine[0]).Factory());
-        const auto&  aspect = factory.getAreaFrac();
+        const auto&  aspect = factory.getSparseAreaFrac();
 
         if (isMFIterSafe(*fine[0], *crse[0]))
         {
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
+            {
+            FArrayBox areafab;
             for (int n=0; n<AMREX_SPACEDIM; ++n) {
                 for (MFIter mfi(*crse[n],true); mfi.isValid(); ++mfi)
                 {
@@ -272,14 +279,16 @@ void EB_average_down_faces (const Array<const MultiFab*,AMREX_SPACEDIM>& fine,
                     }
                     else
                     {
+                       (*aspect[n])[mfi].toFab(areafab, amrex::refine(tbx,ratio), flag_fab);
                        amrex_eb_avgdown_faces(tbx.loVect(), tbx.hiVect(), 
                                               BL_TO_FORTRAN_ANYD((*fine[n])[mfi]), 
                                               BL_TO_FORTRAN_ANYD((*crse[n])[mfi]),
-                                              BL_TO_FORTRAN_ANYD((*aspect[n])[mfi]),
+                                              BL_TO_FORTRAN_ANYD(areafab),
                                               ratio.getVect(), &n, &ncomp);
                     }
                 }
             }
+            }
         }
         else
         {
@@ -318,13 +327,15 @@ void EB_average_down_boundaries (const MultiFab& fine, MultiFab& crse,
     {
         const auto& factory = dynamic_cast<EBFArrayBoxFactory const&>(fine.Factory());
         const auto& flags = factory.getMultiEBCellFlagFab();
-        const auto& barea = factory.getBndryArea();
+        const auto& barea = factory.getSparseBndryArea();
 
         if (isMFIterSafe(fine, crse))
         {
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
+            {
+            FArrayBox bareafab;
             for (MFIter mfi(crse, MFItInfo().EnableTiling().SetDynamic(true)); mfi.isValid(); ++mfi)
             {
                 const Box& tbx = mfi.growntilebox(ngcrse);
@@ -333,13 +344,15 @@ void EB_average_down_boundaries (const MultiFab& fine, MultiFab& crse,
                 if (FabType::covered == typ || FabType::regular == typ) {
                     crse[mfi].setVal(0.0, tbx, 0, 1);
                 } else {
+                    barea[mfi].toFab(bareafab, amrex::refine(tbx,ratio), flags[mfi]);
                     amrex_eb_avgdown_boundaries(tbx.loVect(), tbx.hiVect(),
                                                 BL_TO_FORTRAN_ANYD(fine[mfi]),
                                                 BL_TO_FORTRAN_ANYD(crse[mfi]),
-                                                BL_TO_FORTRAN_ANYD(barea[mfi]),
+                                                BL_TO_FORTRAN_ANYD(bareafab),
                                                 ratio.getVect(), &ncomp);
                 }
             }
+            }
         }
         else
         {
@@ -365,8 +378,8 @@ void EB_computeDivergence (MultiFab& divu, const Array<MultiFab const*,AMREX_SPA
         const auto& factory = dynamic_cast<EBFArrayBoxFactory const&>(divu.Factory());
         const auto& flags = factory.getMultiEBCellFlagFab();
         const auto& vfrac = factory.getVolFrac();
-        const auto& area = factory.getAreaFrac();
-        const auto& fcent = factory.getFaceCent();
+        const auto& area = factory.getSparseAreaFrac();
+        const auto& fcent = factory.getSparseFaceCent();
 
         iMultiFab cc_mask(divu.boxArray(), divu.DistributionMap(), 1, 1);
         cc_mask.setVal(0);
@@ -397,6 +410,9 @@ void EB_computeDivergence (MultiFab& divu, const Array<MultiFab const*,AMREX_SPA
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
+        {
+        Array<FArrayBox,AMREX_SPACEDIM> areafab;
+        Array<FArrayBox,AMREX_SPACEDIM> fcentfab;
         for (MFIter mfi(divu,MFItInfo().EnableTiling().SetDynamic(true)); mfi.isValid(); ++mfi)
         {
             const Box& bx = mfi.tilebox();
@@ -412,6 +428,11 @@ void EB_computeDivergence (MultiFab& divu, const Array<MultiFab const*,AMREX_SPA
             } else if (fabtyp == FabType::regular) {
                 amrex_compute_divergence(bx,divufab,AMREX_D_DECL(ufab,vfab,wfab),dxinv);
             } else {
+                for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                    const Box& fbx = amrex::surroundingNodes(bx,idim);
+                    (*area[idim])[mfi].toFab(areafab[idim], fbx, flagfab);
+                    (*fcent[idim])[mfi].toFab(fcentfab[idim], fbx, flagfab);
+                }
                 amrex_compute_eb_divergence(BL_TO_FORTRAN_BOX(bx),
                                             BL_TO_FORTRAN_ANYD(divufab),
                                             AMREX_D_DECL(BL_TO_FORTRAN_ANYD(ufab),
@@ -420,15 +441,16 @@ void EB_computeDivergence (MultiFab& divu, const Array<MultiFab const*,AMREX_SPA
                                             BL_TO_FORTRAN_ANYD(cc_mask[mfi]),
                                             BL_TO_FORTRAN_ANYD(flagfab),
                                             BL_TO_FORTRAN_ANYD(vfrac[mfi]),
-                                            AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*area[0])[mfi]),
-                                                         BL_TO_FORTRAN_ANYD((*area[1])[mfi]),
-                                                         BL_TO_FORTRAN_ANYD((*area[2])[mfi])),
-                                            AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*fcent[0])[mfi]),
-                                                         BL_TO_FORTRAN_ANYD((*fcent[1])[mfi]),
-                                                         BL_TO_FORTRAN_ANYD((*fcent[2])[mfi])),
+                                            AMREX_D_DECL(BL_TO_FORTRAN_ANYD(areafab[0]),
+                                                         BL_TO_FORTRAN_ANYD(areafab[1]),
+                                                         BL_TO_FORTRAN_ANYD(areafab[2])),
+                                            AMREX_D_DECL(BL_TO_FORTRAN_ANYD(fcentfab[0]),
+                                                         BL_TO_FORTRAN_ANYD(fcentfab[1]),
+                                                         BL_TO_FORTRAN_ANYD(fcentfab[2])),
                                             dxinv.data());
             }
         }
+        }
     }
 }
 
@@ -446,11 +468,13 @@ EB_average_face_to_cellcenter (MultiFab& ccmf, int dcomp,
     {
         const auto& factory = dynamic_cast<EBFArrayBoxFactory const&>(fmf[0]->Factory());
         const auto& flags = factory.getMultiEBCellFlagFab();
-        const auto& area = factory.getAreaFrac();
+        const auto& area = factory.getSparseAreaFrac();
 
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
+        {
+        Array<FArrayBox,AMREX_SPACEDIM> areafab;
         for (MFIter mfi(ccmf,MFItInfo().EnableTiling().SetDynamic(true)); mfi.isValid(); ++mfi)
         {
             const Box& bx = mfi.tilebox();
@@ -465,17 +489,21 @@ EB_average_face_to_cellcenter (MultiFab& ccmf, int dcomp,
             } else if (fabtyp == FabType::regular) {
                 amrex_avg_fc_to_cc(bx,ccfab,AMREX_D_DECL(xfab,yfab,zfab),dcomp);
             } else {
+                for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                    (*area[idim])[mfi].toFab(areafab[idim], amrex::surroundingNodes(bx,idim), flagfab);
+                }
                 amrex_eb_avg_fc_to_cc(BL_TO_FORTRAN_BOX(bx),
                                       BL_TO_FORTRAN_N_ANYD(ccfab,dcomp),
                                       AMREX_D_DECL(BL_TO_FORTRAN_ANYD(xfab),
                                                    BL_TO_FORTRAN_ANYD(yfab),
                                                    BL_TO_FORTRAN_ANYD(zfab)),
-                                      AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*area[0])[mfi]),
-                                                   BL_TO_FORTRAN_ANYD((*area[1])[mfi]),
-                                                   BL_TO_FORTRAN_ANYD((*area[2])[mfi])),
+                                      AMREX_D_DECL(BL_TO_FORTRAN_ANYD(areafab[0]),
+                                                   BL_TO_FORTRAN_ANYD(areafab[1]),
+                                                   BL_TO_FORTRAN_ANYD(areafab[2])),
                                       BL_TO_FORTRAN_ANYD(flagfab));
             }
         }
+        }
     }
 }
 
@@ -8,6 +8,7 @@
 
 #include <AMReX_MultiFabUtil.H>
 #include <AMReX_MultiCutFab.H>
+#include <AMReX_SparseCutFab.H>
 #include "AMReX_BoxIterator.H"
 #include <AMReX_EBCellFlag.H>
 
@@ -16,11 +17,14 @@
 
 #include <AMReX_EB2.H>
 
+#include <limits>
+#include <string>
+
 namespace amrex {
 
 LSFactory::LSFactory(int lev, int ls_ref, int eb_ref, int ls_pad, int eb_pad,
                      const BoxArray & ba, const Geometry & geom, const DistributionMapping & dm,
-                     int eb_tile_size)
+                     int eb_tile_size, bool ls_extend)
     : amr_lev(lev),
       ls_grid_ref(ls_ref), eb_grid_ref(eb_ref),
       ls_grid_pad(ls_pad), eb_grid_pad(eb_pad),
@@ -30,7 +34,7 @@ LSFactory::LSFactory(int lev, int ls_ref, int eb_ref, int ls_pad, int eb_pad,
       dx_eb_vect(AMREX_D_DECL(geom.CellSize()[0]/eb_ref,
                               geom.CellSize()[1]/eb_ref,
                               geom.CellSize()[2]/eb_ref)),
-      eb_tile_size(eb_tile_size)
+      eb_tile_size(eb_tile_size), ls_extend(ls_extend)
 {
     // Init geometry over which the level set and EB are defined
     init_geom(ba, geom, dm);
@@ -79,8 +83,10 @@ LSFactory::LSFactory(const LSFactory & other) :
     LSFactory(other.get_amr_level(),
               other.get_ls_ref(), other.get_eb_ref(),
               other.get_ls_pad(), other.get_eb_pad(),
-              other.get_ba(), other.get_geom(), other.get_dm() )
+              other.get_ba(), other.get_geom(), other.get_dm(),
+              32, other.get_extend() )
 {
+    ls_extend_max_iter = other.get_extend_max_iter();
     //ls_grid  = other.copy_data();
     //ls_valid = other.copy_valid();
 }
@@ -203,7 +209,7 @@ void LSFactory::fill_valid(){
 
 
 std::unique_ptr<Vector<Real>> LSFactory::eb_facets(const FArrayBox & norm_tile,
-                                                   const CutFab & bcent_tile,
+                                                   const FArrayBox & bcent_tile,
                                                    const EBCellFlagFab & flag_tile,
                                                    const RealVect & dx_eb,
                                                    const Box & eb_search)
@@ -266,7 +272,7 @@ std::unique_ptr<Vector<Real>> LSFactory::eb_facets(const EBFArrayBoxFactory & eb
 
     MultiFab dummy(ba, dm, 1, eb_grid_pad, MFInfo(), eb_factory);
     // EB boundary-centre data
-    const MultiCutFab * bndrycent = & eb_factory.getBndryCent();
+    const MultiSparseCutFab * bndrycent = & eb_factory.getSparseBndryCent();
     // EB flags (tests if contains facets)
     const auto& flags = eb_factory.getMultiEBCellFlagFab();
 
@@ -307,6 +313,7 @@ std::unique_ptr<Vector<Real>> LSFactory::eb_facets(const EBFArrayBoxFactory & eb
     facet_list = std::unique_ptr<Vector<Real>>(new Vector<Real>(6 * n_facets));
 
     int c_facets = 0;
+    FArrayBox bcent_tile;
     for(MFIter mfi(dummy); mfi.isValid(); ++mfi) {
         Box tile_box = mfi.growntilebox();
 
@@ -315,7 +322,7 @@ std::unique_ptr<Vector<Real>> LSFactory::eb_facets(const EBFArrayBoxFactory & eb
         //if (flag.getType(amrex::grow(tile_box,1)) == FabType::singlevalued) {
         if (flag.getType(tile_box) == FabType::singlevalued) {
             const auto & norm_tile = normal[mfi];
-            const auto & bcent_tile = (* bndrycent)[mfi];
+            (* bndrycent)[mfi].toFab(bcent_tile, tile_box, flag);
 
             int facet_list_size = facet_list->size();
 
@@ -528,6 +535,145 @@ void LSFactory::regrid(const BoxArray & ba, const DistributionMapping & dm)
 
 
 
+void LSFactory::regrid(const BoxArray & ba, const DistributionMapping & dm,
+                       const EBFArrayBoxFactory & eb_factory, const MultiFab & mf_impfunc)
+{
+    BL_PROFILE("LSFactory::regrid()")
+
+    // The EB has not changed => the level-set only needs to be computed on the
+    // nodes that are not covered by the old BoxArray.
+    const BoxArray ls_ba_old = ls_ba;
+
+    update_ba(ba, dm);
+
+    int ng = ls_grid_pad;
+    std::unique_ptr<MultiFab> ls_grid_new
+        = std::unique_ptr<MultiFab>(new MultiFab(ls_ba, dm, 1, ng));
+
+    ls_grid_new->copy(* ls_grid, 0, 0, 1, 0, ng);
+    ls_grid = std::move(ls_grid_new);
+
+    std::unique_ptr<iMultiFab> ls_valid_new
+        = std::unique_ptr<iMultiFab>(new iMultiFab(ls_ba, dm, 1, ng));
+
+    ls_valid_new->setVal(-1);
+    ls_valid_new->copy(* ls_valid, 0, 0, 1, 0, ng);
+    ls_valid = std::move(ls_valid_new);
+
+    iMultiFab region_valid(ls_ba, dm, 1, ng);
+    region_valid.setVal(0);
+
+    LSFactory::fill_data(* ls_grid, region_valid, eb_factory, mf_impfunc,
+                         IntVect{AMREX_D_DECL(eb_tile_size, eb_tile_size, eb_tile_size)},
+                         ls_grid_ref, eb_grid_ref, geom_ls, geom_eb, ls_ba_old);
+
+    if (ls_extend) {
+        extend_data(threshold(eb_factory), ls_ba_old);
+    } else {
+        ls_grid->FillBoundary(geom_ls.periodicity());
+    }
+
+    fill_valid();
+}
+
+
+
+Real LSFactory::threshold(const EBFArrayBoxFactory & eb_factory) const {
+
+    // Same as the threshold used by fill_data
+    const int eb_pad = eb_factory.getMultiEBCellFlagFab().nGrow();
+
+#if (AMREX_SPACEDIM == 1)
+    const Real min_dx = dx_eb_vect[0];
+#elif (AMREX_SPACEDIM == 2)
+    const Real min_dx = std::min(dx_eb_vect[0], dx_eb_vect[1]);
+#elif (AMREX_SPACEDIM == 3)
+    const Real min_dx = std::min(dx_eb_vect[0], std::min(dx_eb_vect[1], dx_eb_vect[2]));
+#endif
+
+    return min_dx * (eb_pad + 1);
+}
+
+
+
+void LSFactory::extend_data(Real threshold, const BoxArray & ba_skip) {
+
+    BL_PROFILE("LSFactory::extend_data()")
+
+    // Mark the nodes outside the narrow band as unknown
+    Real unknown = std::numeric_limits<Real>::max();
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for(MFIter mfi( * ls_grid, true); mfi.isValid(); ++ mfi) {
+        Box tile_box   = mfi.growntilebox();
+        auto & ls_tile = (* ls_grid)[mfi];
+
+        BoxList reset_boxes(tile_box);
+        if (! ba_skip.empty()) reset_boxes = ba_skip.complementIn(tile_box);
+
+        for (const Box & reset_box : reset_boxes)
+            amrex_eb_reset_levelset(reset_box.loVect(), reset_box.hiVect(), & threshold, & unknown,
+                                    BL_TO_FORTRAN_3D(ls_tile));
+    }
+
+    // Fast sweeping: information crosses (at least) one box boundary per
+    // iteration => iterate until nothing changes
+    const Real tol = 1.e-10 * threshold;
+    Real change;
+    int iter = 0;
+    do {
+        ls_grid->FillBoundary(geom_ls.periodicity());
+
+        change = 0.;
+#ifdef _OPENMP
+#pragma omp parallel reduction(max:change)
+#endif
+        for(MFIter mfi( * ls_grid); mfi.isValid(); ++ mfi) {
+            // Sweep the ghost cells too, so that they are filled where they
+            // are outside of the domain. Only the valid nodes count towards
+            // convergence (FillBoundary resets the others)
+            Box box        = mfi.fabbox();
+            Box valid_box  = mfi.validbox();
+            auto & ls_tile = (* ls_grid)[mfi];
+
+            Real fab_change;
+            amrex_eb_sweep_levelset(box.loVect(), box.hiVect(),
+                                    valid_box.loVect(), valid_box.hiVect(), & threshold,
+                                    BL_TO_FORTRAN_3D(ls_tile),
+                                    dx_vect.dataPtr(), & fab_change);
+
+            change = std::max(change, fab_change);
+        }
+
+        ParallelDescriptor::ReduceRealMax(change);
+        ++iter;
+    } while (change > tol && iter < ls_extend_max_iter);
+
+    // Not converged => the values are still upper bounds of the distance
+    if (change > tol) {
+        amrex::Warning("LSFactory::extend_data: not converged after "
+                       + std::to_string(iter) + " iterations");
+    }
+
+    // Nodes that could not be reached (no EB) are thresholded as before
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for(MFIter mfi( * ls_grid, true); mfi.isValid(); ++ mfi) {
+        Box tile_box   = mfi.growntilebox();
+        auto & ls_tile = (* ls_grid)[mfi];
+
+        amrex_eb_reset_levelset(tile_box.loVect(), tile_box.hiVect(), & unknown, & threshold,
+                                BL_TO_FORTRAN_3D(ls_tile));
+    }
+
+    ls_grid->FillBoundary(geom_ls.periodicity());
+}
+
+
+
 void LSFactory::invert() {
 #ifdef _OPENMP
 #pragma omp parallel
@@ -570,7 +716,8 @@ void LSFactory::fill_data (MultiFab & data, iMultiFab & valid,
                            const EBFArrayBoxFactory & eb_factory,
                            const MultiFab & eb_impfunc,
                            const IntVect & ebt_size, int ls_ref, int eb_ref,
-                           const Geometry & geom, const Geometry & geom_eb) {
+                           const Geometry & geom, const Geometry & geom_eb,
+                           const BoxArray & ba_skip) {
 
     BL_PROFILE("LSFactory::fill_data()")
 
@@ -608,7 +755,7 @@ void LSFactory::fill_data (MultiFab & data, iMultiFab & valid,
      *                                                                          *
      ***************************************************************************/
 
-    const MultiCutFab & bndrycent = eb_factory.getBndryCent();
+    const MultiSparseCutFab & bndrycent = eb_factory.getSparseBndryCent();
     const auto & flags = eb_factory.getMultiEBCellFlagFab();
 
     // make sure to use the EB-factory's ngrow for the eb-padding;
@@ -654,6 +801,15 @@ void LSFactory::fill_data (MultiFab & data, iMultiFab & valid,
     const Real min_dx = std::min(dx_eb[0], std::min(dx_eb[1], dx_eb[2]));
 #endif
 
+    // eb_pad => we know that any EB is _at least_ eb_pad away from the edge of
+    // the eb search box => the level-set is thresholded at ls_threshold
+    const Real ls_threshold = min_dx * (eb_pad+1);
+
+    // The distance to an EB facet is at most one EB cell diagonal shorter
+    // than the distance to its centre => facets whose centre is further than
+    // ls_band from a node can't bring it below the threshold
+    const Real ls_band = ls_threshold + dx_eb.vectorLength();
+
 
     /****************************************************************************
      *                                                                          *
@@ -671,21 +827,33 @@ void LSFactory::fill_data (MultiFab & data, iMultiFab & valid,
         // Fill grown tile box => fill ghost cells as well
         Box tile_box = mfi.growntilebox();
 
+        // ... except for the nodes in ba_skip
+        BoxList fill_boxes(tile_box);
+        if (! ba_skip.empty()) {
+            fill_boxes = ba_skip.complementIn(tile_box);
+            if (fill_boxes.isEmpty()) continue;
+        }
+
 
         //_______________________________________________________________________
         // Don't do anything for the current tile if EB facets are ill-defined
         if (! bndrycent.ok(mfi)){
             auto & ls_tile = data[mfi];
-            ls_tile.setVal( min_dx * eb_pad , tile_box );
 
             // Ensure that tile-wise assignment is validated
             const auto & if_tile = eb_impfunc[mfi];
                   auto & v_tile  = eb_valid[mfi];
 
-            amrex_eb_validate_levelset(BL_TO_FORTRAN_BOX(tile_box), & ls_ref,
-                                       BL_TO_FORTRAN_3D(if_tile),
-                                       BL_TO_FORTRAN_3D(v_tile),
-                                       BL_TO_FORTRAN_3D(ls_tile)   );
+            for (const Box & fill_box : fill_boxes) {
+                // At the threshold, so that extend_data treats these nodes as
+                // unknown
+                ls_tile.setVal( ls_threshold , fill_box );
+
+                amrex_eb_validate_levelset(BL_TO_FORTRAN_BOX(fill_box), & ls_ref,
+                                           BL_TO_FORTRAN_3D(if_tile),
+                                           BL_TO_FORTRAN_3D(v_tile),
+                                           BL_TO_FORTRAN_3D(ls_tile)   );
+            }
 
             continue;
         }
@@ -708,7 +876,8 @@ void LSFactory::fill_data (MultiFab & data, iMultiFab & valid,
         const auto & flag       = flags[mfi];
         const auto & if_tile    = eb_impfunc[mfi];
         const auto & norm_tile  = normal[mfi];
-        const auto & bcent_tile = bndrycent[mfi];
+        FArrayBox bcent_tile;
+        bndrycent[mfi].toFab(bcent_tile, eb_search, flag);
 
         auto & v_tile      = eb_valid[mfi];
         auto & ls_tile     = data[mfi];
@@ -722,37 +891,37 @@ void LSFactory::fill_data (MultiFab & data, iMultiFab & valid,
         int len_facets = facets->size();
 
 
-        //_______________________________________________________________________
-        // Fill local level-set
-        if (len_facets > 0) {
+        for (const Box & fill_box : fill_boxes) {
 
-            amrex_eb_fill_levelset(BL_TO_FORTRAN_BOX(tile_box),
-                                   facets->dataPtr(), & len_facets,
-                                   BL_TO_FORTRAN_3D(v_tile),
-                                   BL_TO_FORTRAN_3D(ls_tile),
-                                   dx.dataPtr(), dx_eb.dataPtr() );
+            //___________________________________________________________________
+            // Fill local level-set (in the narrow band)
+            if (len_facets > 0) {
 
-            region_tile.setVal(1);
-        } else {
-            ls_tile.setVal( min_dx * ( eb_pad + 1 ) , tile_box );
-        }
+                amrex_eb_fill_levelset_nb(BL_TO_FORTRAN_BOX(fill_box),
+                                          facets->dataPtr(), & len_facets,
+                                          BL_TO_FORTRAN_3D(v_tile),
+                                          BL_TO_FORTRAN_3D(ls_tile),
+                                          dx.dataPtr(), dx_eb.dataPtr(), & ls_band);
 
+                region_tile.setVal(1, fill_box);
+            } else {
+                ls_tile.setVal( ls_threshold , fill_box );
+            }
 
-        //_______________________________________________________________________
-        // Threshold local level-set
-        Real ls_threshold = min_dx * (eb_pad+1); //eb_pad => we know that any EB
-                                                 //is _at least_ eb_pad away from
-                                                 //the edge of the eb search box
-        amrex_eb_threshold_levelset(BL_TO_FORTRAN_BOX(tile_box), & ls_threshold,
-                                    BL_TO_FORTRAN_3D(ls_tile));
 
+            //___________________________________________________________________
+            // Threshold local level-set
+            amrex_eb_threshold_levelset(BL_TO_FORTRAN_BOX(fill_box), & ls_threshold,
+                                        BL_TO_FORTRAN_3D(ls_tile));
 
-        //_______________________________________________________________________
-        // Validate level-set (here so that tile-wise assignment is still validated)
-        amrex_eb_validate_levelset(BL_TO_FORTRAN_BOX(tile_box), & ls_ref,
-                                   BL_TO_FORTRAN_3D(if_tile),
-                                   BL_TO_FORTRAN_3D(v_tile),
-                                   BL_TO_FORTRAN_3D(ls_tile)   );
+
+            //___________________________________________________________________
+            // Validate level-set (here so that tile-wise assignment is still validated)
+            amrex_eb_validate_levelset(BL_TO_FORTRAN_BOX(fill_box), & ls_ref,
+                                       BL_TO_FORTRAN_3D(if_tile),
+                                       BL_TO_FORTRAN_3D(v_tile),
+                                       BL_TO_FORTRAN_3D(ls_tile)   );
+        }
     }
 }
 
@@ -794,6 +963,7 @@ std::unique_ptr<iMultiFab> LSFactory::fill(const EBFArrayBoxFactory & eb_factory
     LSFactory::fill_data(* ls_grid, * region_valid, eb_factory, mf_impfunc,
                          ebt_size, ls_grid_ref, eb_grid_ref, geom_ls, geom_eb);
 
+    if (ls_extend) extend_data(threshold(eb_factory));
 
     fill_valid();
 
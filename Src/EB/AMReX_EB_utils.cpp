@@ -3,6 +3,7 @@
 #include <AMReX_EB_utils.H>
 #include <AMReX_Geometry.H>
 #include <AMReX_MultiCutFab.H>
+#include <AMReX_SparseCutFab.H>
 #include <AMReX_EBFabFactory.H>
 
 
@@ -18,13 +19,15 @@ namespace amrex {
         // Dummy array for MFIter
         MultiFab dummy(ba, dm, 1, n_grow, MFInfo(), eb_factory);
         // Area fraction data
-        std::array<const MultiCutFab*, AMREX_SPACEDIM> areafrac = eb_factory.getAreaFrac();
+        std::array<const MultiSparseCutFab*, AMREX_SPACEDIM> areafrac = eb_factory.getSparseAreaFrac();
 
         const auto & flags = eb_factory.getMultiEBCellFlagFab();
 
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
+        {
+        std::array<FArrayBox, AMREX_SPACEDIM> af_tile;
         for(MFIter mfi(dummy, true); mfi.isValid(); ++mfi) {
             Box tile_box = mfi.growntilebox();
             const int * lo = tile_box.loVect();
@@ -36,9 +39,11 @@ namespace amrex {
                 // Target for compute_normals(...)
                 auto & norm_tile = normals[mfi];
                 // Area fractions in x, y, and z directions
-                const auto & af_x_tile = (* areafrac[0])[mfi];
-                const auto & af_y_tile = (* areafrac[1])[mfi];
-                const auto & af_z_tile = (* areafrac[2])[mfi];
+                for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
+                    (* areafrac[idim])[mfi].toFab(af_tile[idim], amrex::surroundingNodes(tile_box, idim), flag);
+                const auto & af_x_tile = af_tile[0];
+                const auto & af_y_tile = af_tile[1];
+                const auto & af_z_tile = af_tile[2];
 
                 amrex_eb_compute_normals(lo, hi,
                                          BL_TO_FORTRAN_3D(flag),
@@ -48,6 +53,7 @@ namespace amrex {
                                          BL_TO_FORTRAN_3D(af_z_tile)  );
             }
         }
+        }
 
         normals.FillBoundary(geom.periodicity());
     }
@@ -0,0 +1,303 @@
+
+#include <AMReX_SparseCutFab.H>
+#include <AMReX_MultiFab.H>
+
+#include <algorithm>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace amrex {
+
+namespace {
+    // Calls f with each cell next to point iv of a box of index type t.
+    template <class F>
+    void forEachAdjacentCell (const IntVect& iv, const IndexType& t, F&& f)
+    {
+        for (int m = 0; m < (1 << AMREX_SPACEDIM); ++m)
+        {
+            IntVect cell = iv;
+            bool skip = false;
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
+            {
+                if (m & (1 << idim)) {
+                    if (t.nodeCentered(idim)) {
+                        cell[idim] -= 1;
+                    } else {
+                        skip = true;
+                    }
+                }
+            }
+            if (!skip) f(cell);
+        }
+    }
+}
+
+void
+SparseCutFab::define (const FArrayBox& src, const EBCellFlagFab& flags,
+                      Real regular_value, Real covered_value)
+{
+    m_box = src.box();
+    m_ncomp = src.nComp();
+    m_regular_value = regular_value;
+    m_covered_value = covered_value;
+
+    const int nrows = m_box.numPts() / m_box.length(0);
+    m_rowptr.resize(nrows+1);
+    m_index.clear();
+    m_data.clear();
+
+    const int ilo = m_box.smallEnd(0);
+    const int ihi = m_box.bigEnd(0);
+
+    m_rowptr[0] = 0;
+    for (int r = 0; r < nrows; ++r)
+    {
+        IntVect iv = rowStart(r);
+        for (int i = ilo; i <= ihi; ++i)
+        {
+            iv[0] = i;
+            const int c = classify(iv, flags);
+            bool keep = (c & cut_point);
+            if (!keep) {
+                const Real v = (c & irregular_point) ? m_covered_value : m_regular_value;
+                for (int n = 0; n < m_ncomp && !keep; ++n) {
+                    keep = (src(iv,n) != v);
+                }
+            }
+            if (keep) {
+                m_index.push_back(i);
+                for (int n = 0; n < m_ncomp; ++n) {
+                    m_data.push_back(src(iv,n));
+                }
+            }
+        }
+        m_rowptr[r+1] = m_index.size();
+    }
+
+    m_index.shrink_to_fit();
+    m_data.shrink_to_fit();
+}
+
+void
+SparseCutFab::clear ()
+{
+    m_box = Box();
+    m_ncomp = 0;
+    m_rowptr.clear();
+    m_index.clear();
+    m_data.clear();
+}
+
+int
+SparseCutFab::row (const IntVect& iv) const
+{
+    AMREX_ASSERT(m_box.contains(iv));
+#if (AMREX_SPACEDIM == 1)
+    return 0;
+#elif (AMREX_SPACEDIM == 2)
+    return iv[1]-m_box.smallEnd(1);
+#else
+    return (iv[1]-m_box.smallEnd(1)) + (iv[2]-m_box.smallEnd(2))*m_box.length(1);
+#endif
+}
+
+IntVect
+SparseCutFab::rowStart (int r) const
+{
+    IntVect iv = m_box.smallEnd();
+#if (AMREX_SPACEDIM == 2)
+    iv[1] += r;
+#elif (AMREX_SPACEDIM == 3)
+    iv[1] += r % m_box.length(1);
+    iv[2] += r / m_box.length(1);
+#endif
+    return iv;
+}
+
+int
+SparseCutFab::find (const IntVect& iv) const
+{
+    if (!m_box.contains(iv)) return -1;
+    const int r = row(iv);
+    const int* first = m_index.data() + m_rowptr[r];
+    const int* last  = m_index.data() + m_rowptr[r+1];
+    const int* p = std::lower_bound(first, last, iv[0]);
+    return (p != last && *p == iv[0]) ? static_cast<int>(p-m_index.data()) : -1;
+}
+
+int
+SparseCutFab::classify (const IntVect& iv, const EBCellFlagFab& flags) const
+{
+    const Box& fbx = flags.box();
+    int r = 0;
+    forEachAdjacentCell(iv, m_box.ixType(), [&] (const IntVect& cell) {
+        if (fbx.contains(cell)) {
+            const EBCellFlag& flag = flags(cell);
+            if (flag.isSingleValued()) r |= (cut_point | irregular_point);
+            else if (!flag.isRegular()) r |= irregular_point;
+        }
+    });
+    return r;
+}
+
+Real
+SparseCutFab::defaultValue (const IntVect& iv, const EBCellFlagFab& flags) const
+{
+    return (classify(iv,flags) & irregular_point) ? m_covered_value : m_regular_value;
+}
+
+Real
+SparseCutFab::operator() (const IntVect& iv, int comp, const EBCellFlagFab& flags) const
+{
+    const int n = find(iv);
+    return (n >= 0) ? value(n,comp) : defaultValue(iv,flags);
+}
+
+void
+SparseCutFab::copyTo (FArrayBox& dst, const Box& bx, const EBCellFlagFab& flags, int dcomp) const
+{
+    AMREX_ASSERT(bx.ixType() == m_box.ixType());
+    const Box& b = bx & m_box & dst.box();
+    if (!b.ok()) return;
+
+    for (IntVect iv = b.smallEnd(); b.contains(iv); b.next(iv))
+    {
+        const Real v = defaultValue(iv, flags);
+        for (int n = 0; n < m_ncomp; ++n) {
+            dst(iv,dcomp+n) = v;
+        }
+    }
+
+    // Only the rows that cross b, and within a row only the points
+    // from b.smallEnd(0) to b.bigEnd(0).
+    Box rows = b;
+    rows.setBig(0, b.smallEnd(0));
+    const int ihi = b.bigEnd(0);
+    for (IntVect iv = rows.smallEnd(); rows.contains(iv); rows.next(iv))
+    {
+        const int r = row(iv);
+        const int* first = m_index.data() + m_rowptr[r];
+        const int* last  = m_index.data() + m_rowptr[r+1];
+        IntVect jv = iv;
+        for (int e = std::lower_bound(first, last, iv[0]) - m_index.data();
+             e < m_rowptr[r+1] && m_index[e] <= ihi; ++e)
+        {
+            jv[0] = m_index[e];
+            for (int n = 0; n < m_ncomp; ++n) {
+                dst(jv,dcomp+n) = m_data[e*m_ncomp+n];
+            }
+        }
+    }
+}
+
+void
+SparseCutFab::toFab (FArrayBox& dst, const Box& bx, const EBCellFlagFab& flags) const
+{
+    const Box& b = bx & m_box;
+    dst.resize(b, m_ncomp);
+    copyTo(dst, b, flags);
+}
+
+std::size_t
+SparseCutFab::nBytes () const
+{
+    return sizeof(int)*(m_rowptr.size() + m_index.size()) + sizeof(Real)*m_data.size();
+}
+
+MultiSparseCutFab::MultiSparseCutFab (const MultiCutFab& src, const FabArray<EBCellFlagFab>& cellflags,
+                                      Real regular_value, Real covered_value)
+{
+    define(src, cellflags, regular_value, covered_value);
+}
+
+void
+MultiSparseCutFab::define (const MultiCutFab& src, const FabArray<EBCellFlagFab>& cellflags,
+                           Real regular_value, Real covered_value)
+{
+    BL_PROFILE("MultiSparseCutFab::define()");
+
+    m_data.define(src.boxArray(), src.DistributionMap());
+    m_cellflags = &cellflags;
+    m_ncomp = src.nComp();
+    m_ngrow = src.nGrow();
+    m_regular_value = regular_value;
+    m_covered_value = covered_value;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(src.data()); mfi.isValid(); ++mfi)
+    {
+        if (ok(mfi)) {
+            m_data[mfi].define(src[mfi], cellflags[mfi], regular_value, covered_value);
+        }
+    }
+}
+
+const SparseCutFab&
+MultiSparseCutFab::operator[] (const MFIter& mfi) const
+{
+    AMREX_ASSERT(ok(mfi));
+    return m_data[mfi];
+}
+
+bool
+MultiSparseCutFab::ok (const MFIter& mfi) const
+{
+    return (*m_cellflags)[mfi].getType() == FabType::singlevalued;
+}
+
+void
+MultiSparseCutFab::copyTo (MultiCutFab& dst) const
+{
+    BL_PROFILE("MultiSparseCutFab::copyTo()");
+
+    AMREX_ASSERT(dst.boxArray() == boxArray() && dst.nComp() == m_ncomp);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(dst.data()); mfi.isValid(); ++mfi)
+    {
+        if (ok(mfi)) {
+            CutFab& fab = dst[mfi];
+            m_data[mfi].copyTo(fab, fab.box(), (*m_cellflags)[mfi]);
+        }
+    }
+}
+
+MultiFab
+MultiSparseCutFab::ToMultiFab (Real regular_value, Real covered_value) const
+{
+    MultiFab mf(boxArray(), DistributionMap(), m_ncomp, m_ngrow);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(mf); mfi.isValid(); ++mfi)
+    {
+        auto t = (*m_cellflags)[mfi].getType();
+        if (t == FabType::singlevalued) {
+            m_data[mfi].copyTo(mf[mfi], mf[mfi].box(), (*m_cellflags)[mfi]);
+        } else if (t == FabType::regular) {
+            mf[mfi].setVal(regular_value);
+        } else {
+            mf[mfi].setVal(covered_value);
+        }
+    }
+    return mf;
+}
+
+std::size_t
+MultiSparseCutFab::nBytes () const
+{
+    std::size_t r = 0;
+    for (MFIter mfi(m_data); mfi.isValid(); ++mfi)
+    {
+        r += m_data[mfi].nBytes();
+    }
+    return r;
+}
+
+}
@@ -8,6 +8,7 @@
 #include <AMReX_MultiFabUtil.H>
 #include <AMReX_EBMultiFabUtil.H>
 #include <AMReX_EB2.H>
+#include <AMReX_SparseCutFab.H>
 
 #include <AMReX_MLNodeLap_F.H>
 
@@ -74,9 +75,9 @@ void compute_integrals(MultiFab* intg)
     const auto& my_factory = dynamic_cast<EBFArrayBoxFactory const&>(intg->Factory());
 
     const MultiFab*    vfrac = &(my_factory.getVolFrac());
-    const MultiCutFab* bcent = &(my_factory.getBndryCent());
-    const MultiCutFab* ccent = &(my_factory.getCentroid());
-    const MultiCutFab* bnorm = &(my_factory.getBndryNormal());
+    const MultiSparseCutFab* bcent = &(my_factory.getSparseBndryCent());
+    const MultiSparseCutFab* ccent = &(my_factory.getSparseCentroid());
+    const MultiSparseCutFab* bnorm = &(my_factory.getSparseBndryNormal());
     const auto&        flags =   my_factory.getMultiEBCellFlagFab();
 
     int i_S_x     =  1-1;
@@ -144,13 +145,13 @@ void compute_integrals(MultiFab* intg)
 
              if (volfrac < (1.0-1.e-12) && volfrac > 1.0e-12) 
              {
-                 const Real centx = (*bcent)[mfi](iv,0);
-                 const Real centy = (*bcent)[mfi](iv,1);
-                 const Real centz = (*bcent)[mfi](iv,2);
+                 const Real centx = (*bcent)[mfi](iv,0,flag);
+                 const Real centy = (*bcent)[mfi](iv,1,flag);
+                 const Real centz = (*bcent)[mfi](iv,2,flag);
     
-                 const Real normx = (*bnorm)[mfi](iv,0);
-                 const Real normy = (*bnorm)[mfi](iv,1);
-                 const Real normz = (*bnorm)[mfi](iv,2);
+                 const Real normx = (*bnorm)[mfi](iv,0,flag);
+                 const Real normy = (*bnorm)[mfi](iv,1,flag);
+                 const Real normz = (*bnorm)[mfi](iv,2,flag);
 
                  eb_phi.setCent(centx,centy,centz);
                  eb_phi.setNormal(normx,normy,normz);
@@ -167,12 +168,12 @@ void compute_integrals(MultiFab* intg)
 #if 0
                     std::cout << "Volume fractions don't match!" << std::endl;
                     std::cout << "VF " << iv << " " << volfrac << " " << volume << std::endl;
-                    std::cout << "  Using bndry cent:" << (*bcent)[mfi](iv,0) << " " 
-                                                       << (*bcent)[mfi](iv,1) << " " 
-                                                       << (*bcent)[mfi](iv,2) << std::endl;
-                    std::cout << "  Using bndry norm:" << (*bnorm)[mfi](iv,0) << " " 
-                                                       << (*bnorm)[mfi](iv,1) << " " 
-                                                       << (*bnorm)[mfi](iv,2) << std::endl;
+                    std::cout << "  Using bndry cent:" << (*bcent)[mfi](iv,0,flag) << " " 
+                                                       << (*bcent)[mfi](iv,1,flag) << " " 
+                                                       << (*bcent)[mfi](iv,2,flag) << std::endl;
+                    std::cout << "  Using bndry norm:" << (*bnorm)[mfi](iv,0,flag) << " " 
+                                                       << (*bnorm)[mfi](iv,1,flag) << " " 
+                                                       << (*bnorm)[mfi](iv,2,flag) << std::endl;
 #endif
                     vol_diff = std::max(vol_diff,std::abs(volfrac - volume));
                     // exit(0);
@@ -230,21 +231,21 @@ void compute_integrals(MultiFab* intg)
                  n_count++;
 
 #if 0
-                 if (std::abs(val_S_x/volume - (*ccent)[mfi](iv,0)) > 1.e-12 || 
-                     std::abs(val_S_y/volume - (*ccent)[mfi](iv,1)) > 1.e-12 || 
-                     std::abs(val_S_z/volume - (*ccent)[mfi](iv,2)) > 1.e-12 )
+                 if (std::abs(val_S_x/volume - (*ccent)[mfi](iv,0,flag)) > 1.e-12 || 
+                     std::abs(val_S_y/volume - (*ccent)[mfi](iv,1,flag)) > 1.e-12 || 
+                     std::abs(val_S_z/volume - (*ccent)[mfi](iv,2,flag)) > 1.e-12 )
                  { 
                     std::cout << "Centroid doesn't match!" << std::endl;
                     std::cout << "IV                " << iv     << std::endl;
                     std::cout << "VF                " << volume << std::endl;
-                    std::cout << "Centroid from amrex:  " << (*ccent)[mfi](iv,0) << " " 
-                                                          << (*ccent)[mfi](iv,1) << " " 
-                                                          << (*ccent)[mfi](iv,2) << std::endl;
+                    std::cout << "Centroid from amrex:  " << (*ccent)[mfi](iv,0,flag) << " " 
+                                                          << (*ccent)[mfi](iv,1,flag) << " " 
+                                                          << (*ccent)[mfi](iv,2,flag) << std::endl;
 
                     std::cout << "Centroid from algoim: " << val_S_x/volume << " " << val_S_y/volume << " " << val_S_z/volume << std::endl;
-                    std::cout << "Norm from amrex     : " << (*bnorm)[mfi](iv,0) << " " 
-                                                          << (*bnorm)[mfi](iv,1) << " " 
-                                                          << (*bnorm)[mfi](iv,2) << "\n" << std::endl;
+                    std::cout << "Norm from amrex     : " << (*bnorm)[mfi](iv,0,flag) << " " 
+                                                          << (*bnorm)[mfi](iv,1,flag) << " " 
+                                                          << (*bnorm)[mfi](iv,2,flag) << "\n" << std::endl;
                     exit(0);
                  }
 #endif
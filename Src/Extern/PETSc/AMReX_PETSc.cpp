@@ -4,6 +4,7 @@
 
 #ifdef AMREX_USE_EB
 #include <AMReX_MultiCutFab.H>
+#include <AMReX_SparseCutFab.H>
 #include <AMReX_EBFabFactory.H>
 #endif
 
@@ -177,12 +178,12 @@ PETScABecLap::prepareSolver ()
     auto ebfactory = dynamic_cast<EBFArrayBoxFactory const*>(m_factory);
     const FabArray<EBCellFlagFab>* flags = (ebfactory) ? &(ebfactory->getMultiEBCellFlagFab()) : nullptr;
     const MultiFab* vfrac = (ebfactory) ? &(ebfactory->getVolFrac()) : nullptr;
-    auto area = (ebfactory) ? ebfactory->getAreaFrac()
-        : Array<const MultiCutFab*,AMREX_SPACEDIM>{AMREX_D_DECL(nullptr,nullptr,nullptr)};
-    auto fcent = (ebfactory) ? ebfactory->getFaceCent()
-        : Array<const MultiCutFab*,AMREX_SPACEDIM>{AMREX_D_DECL(nullptr,nullptr,nullptr)};
-    auto barea = (ebfactory) ? &(ebfactory->getBndryArea()) : nullptr;
-    auto bcent = (ebfactory) ? &(ebfactory->getBndryCent()) : nullptr;
+    auto area = (ebfactory) ? ebfactory->getSparseAreaFrac()
+        : Array<const MultiSparseCutFab*,AMREX_SPACEDIM>{AMREX_D_DECL(nullptr,nullptr,nullptr)};
+    auto fcent = (ebfactory) ? ebfactory->getSparseFaceCent()
+        : Array<const MultiSparseCutFab*,AMREX_SPACEDIM>{AMREX_D_DECL(nullptr,nullptr,nullptr)};
+    auto barea = (ebfactory) ? &(ebfactory->getSparseBndryArea()) : nullptr;
+    auto bcent = (ebfactory) ? &(ebfactory->getSparseBndryCent()) : nullptr;
 #endif
 
     HYPRE_Int ncells_proc = 0;
@@ -278,6 +279,10 @@ PETScABecLap::prepareSolver ()
     BaseFab<HYPRE_Int> ifab;
     FArrayBox foo(Box::TheUnitBox());
     const int is_eb_dirichlet = m_eb_b_coeffs != nullptr;
+#ifdef AMREX_USE_EB
+    Array<FArrayBox,AMREX_SPACEDIM> areafab, fcentfab;
+    FArrayBox bareafab, bcentfab;
+#endif
     for (MFIter mfi(acoefs); mfi.isValid(); ++mfi)
     {
         const Box& bx = mfi.validbox();
@@ -330,6 +335,15 @@ PETScABecLap::prepareSolver ()
             else
             {
                 FArrayBox const& beb = (is_eb_dirichlet) ? (*m_eb_b_coeffs)[mfi] : foo;
+
+                const Box& gbx = amrex::grow(bx,1);
+                const auto& flagfab = (*flags)[mfi];
+                for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                    (*area[idim])[mfi].toFab(areafab[idim], amrex::surroundingNodes(gbx,idim), flagfab);
+                    (*fcent[idim])[mfi].toFab(fcentfab[idim], amrex::surroundingNodes(gbx,idim), flagfab);
+                }
+                (*barea)[mfi].toFab(bareafab, gbx, flagfab);
+                (*bcent)[mfi].toFab(bcentfab, gbx, flagfab);
                 
                 amrex_hpeb_ijmatrix(BL_TO_FORTRAN_BOX(bx),
                                     &nrows, ncols, rows, cols, mat,
@@ -342,14 +356,14 @@ PETScABecLap::prepareSolver ()
                                                  BL_TO_FORTRAN_ANYD(bcoefs[2][mfi])),
                                     BL_TO_FORTRAN_ANYD((*flags)[mfi]),
                                     BL_TO_FORTRAN_ANYD((*vfrac)[mfi]),
-                                    AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*area[0])[mfi]),
-                                                 BL_TO_FORTRAN_ANYD((*area[1])[mfi]),
-                                                 BL_TO_FORTRAN_ANYD((*area[2])[mfi])),
-                                    AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*fcent[0])[mfi]),
-                                                 BL_TO_FORTRAN_ANYD((*fcent[1])[mfi]),
-                                                 BL_TO_FORTRAN_ANYD((*fcent[2])[mfi])),
-                                    BL_TO_FORTRAN_ANYD((*barea)[mfi]),
-                                    BL_TO_FORTRAN_ANYD((*bcent)[mfi]),
+                                    AMREX_D_DECL(BL_TO_FORTRAN_ANYD(areafab[0]),
+                                                 BL_TO_FORTRAN_ANYD(areafab[1]),
+                                                 BL_TO_FORTRAN_ANYD(areafab[2])),
+                                    AMREX_D_DECL(BL_TO_FORTRAN_ANYD(fcentfab[0]),
+                                                 BL_TO_FORTRAN_ANYD(fcentfab[1]),
+                                                 BL_TO_FORTRAN_ANYD(fcentfab[2])),
+                                    BL_TO_FORTRAN_ANYD(bareafab),
+                                    BL_TO_FORTRAN_ANYD(bcentfab),
                                     BL_TO_FORTRAN_ANYD(beb), &is_eb_dirichlet,
                                     &scalar_a, &scalar_b, dx,
                                     bctype.data(), bcl.data(), &bho);
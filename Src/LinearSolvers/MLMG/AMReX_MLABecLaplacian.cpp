@@ -11,9 +11,10 @@ MLABecLaplacian::MLABecLaplacian (const Vector<Geometry>& a_geom,
                                   const Vector<BoxArray>& a_grids,
                                   const Vector<DistributionMapping>& a_dmap,
                                   const LPInfo& a_info,
-                                  const Vector<FabFactory<FArrayBox> const*>& a_factory)
+                                  const Vector<FabFactory<FArrayBox> const*>& a_factory,
+                                  int a_ncomp)
 {
-    define(a_geom, a_grids, a_dmap, a_info, a_factory);
+    define(a_geom, a_grids, a_dmap, a_info, a_factory, a_ncomp);
 }
 
 void
@@ -21,10 +22,14 @@ MLABecLaplacian::define (const Vector<Geometry>& a_geom,
                          const Vector<BoxArray>& a_grids,
                          const Vector<DistributionMapping>& a_dmap,
                          const LPInfo& a_info,
-                         const Vector<FabFactory<FArrayBox> const*>& a_factory)
+                         const Vector<FabFactory<FArrayBox> const*>& a_factory,
+                         int a_ncomp)
 {
     BL_PROFILE("MLABecLaplacian::define()");
 
+    AMREX_ALWAYS_ASSERT(a_ncomp >= 1);
+    m_ncomp = a_ncomp;
+
     MLCellABecLap::define(a_geom, a_grids, a_dmap, a_info, a_factory);
 
     m_a_coeffs.resize(m_num_amr_levels);
@@ -247,7 +252,7 @@ MLABecLaplacian::Fapply (int amrlev, int mglev, MultiFab& out, const MultiFab& i
                               AMREX_D_DECL(BL_TO_FORTRAN_ANYD(bxfab),
                                            BL_TO_FORTRAN_ANYD(byfab),
                                            BL_TO_FORTRAN_ANYD(bzfab)),
-                              dxinv, m_a_scalar, m_b_scalar);
+                              dxinv, m_a_scalar, m_b_scalar, m_ncomp);
 
     }
 }
@@ -282,7 +287,7 @@ MLABecLaplacian::normalize (int amrlev, int mglev, MultiFab& mf) const
                                   AMREX_D_DECL(BL_TO_FORTRAN_ANYD(bxfab),
                                                BL_TO_FORTRAN_ANYD(byfab),
                                                BL_TO_FORTRAN_ANYD(bzfab)),
-                                  dxinv, m_a_scalar, m_b_scalar);
+                                  dxinv, m_a_scalar, m_b_scalar, m_ncomp);
 
     }
 }
@@ -323,7 +328,7 @@ MLABecLaplacian::Fsmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab&
 #endif
 #endif
 
-    const int nc = 1;
+    const int nc = m_ncomp;
     const Real* h = m_geom[amrlev][mglev].CellSize();
 
 #ifdef _OPENMP
@@ -445,7 +450,7 @@ MLABecLaplacian::FFlux (int amrlev, const MFIter& mfi,
                          AMREX_D_DECL(BL_TO_FORTRAN_ANYD(bx),
                                       BL_TO_FORTRAN_ANYD(by),
                                       BL_TO_FORTRAN_ANYD(bz)),
-                         dxinv, m_b_scalar, face_only);
+                         dxinv, m_b_scalar, face_only, m_ncomp);
 }
 
 void
@@ -453,6 +458,8 @@ MLABecLaplacian::update ()
 {
     if (MLCellABecLap::needsUpdate()) MLCellABecLap::update();
 
+    m_smoother_ready = false;
+
 #if (AMREX_SPACEDIM != 3)
     applyMetricTermsCoeffs();
 #endif
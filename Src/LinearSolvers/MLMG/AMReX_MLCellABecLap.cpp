@@ -8,6 +8,95 @@
 
 namespace amrex {
 
+namespace {
+
+// Coefficient that is the same in every cell or on every face
+struct ConstCoefSingle
+{
+    float v;
+    float operator() (int, int, int) const { return v; }
+};
+
+// r = rhs - L(x) on a tile of size len, with a = alpha*a and b = beta*b/dx^2
+template <class AC, class BC>
+void abecResidSingle (const Dim3& len, int ncomp,
+                      const FabView<float>& r, const FabView<float const>& x,
+                      const FabView<float const>& rhs, const AC& a,
+                      AMREX_D_DECL(const BC& bX, const BC& bY, const BC& bZ))
+{
+    for (int n = 0; n < ncomp; ++n) {
+        for         (int k = 0; k < len.z; ++k) {
+            for     (int j = 0; j < len.y; ++j) {
+                AMREX_PRAGMA_SIMD
+                for (int i = 0; i < len.x; ++i) {
+                    const float xc = x(i,j,k,n);
+                    r(i,j,k,n) = rhs(i,j,k,n) - (a(i,j,k)*xc
+                        AMREX_D_TERM(+ bX(i,j,k)*(xc-x(i-1,j,k,n)) - bX(i+1,j,k)*(x(i+1,j,k,n)-xc),
+                                     + bY(i,j,k)*(xc-x(i,j-1,k,n)) - bY(i,j+1,k)*(x(i,j+1,k,n)-xc),
+                                     + bZ(i,j,k)*(xc-x(i,j,k-1,n)) - bZ(i,j,k+1)*(x(i,j,k+1,n)-xc)));
+                }
+            }
+        }
+    }
+}
+
+// Same as amrex_abec_gsrb on a tile.  lo is the lower corner of the
+// tile, [vlo,vhi] is the valid box relative to the tile, cf holds
+// d(ghost)/d(first interior cell) on the faces of the valid box and m
+// the masks of the ghost cells.
+template <class AC, class BC>
+void abecGSRBSingle (const Dim3& lo, const Dim3& len, const Dim3& vlo, const Dim3& vhi,
+                     int ncomp, int redblack, float omega,
+                     const FabView<float>& phi, const FabView<float const>& rhs, const AC& a,
+                     AMREX_D_DECL(const BC& bX, const BC& bY, const BC& bZ),
+                     const float* cf, const Array<FabView<int const>,2*AMREX_SPACEDIM>& m)
+{
+    const Orientation xlo(0,Orientation::low), xhi(0,Orientation::high);
+#if (AMREX_SPACEDIM > 1)
+    const Orientation ylo(1,Orientation::low), yhi(1,Orientation::high);
+#endif
+#if (AMREX_SPACEDIM > 2)
+    const Orientation zlo(2,Orientation::low), zhi(2,Orientation::high);
+#endif
+
+    for (int n = 0; n < ncomp; ++n) {
+        for         (int k = 0; k < len.z; ++k) {
+            for     (int j = 0; j < len.y; ++j) {
+                const int ioff = (lo.x + j + lo.y + k + lo.z + redblack) & 1;
+                for (int i = ioff; i < len.x; i += 2) {
+                    AMREX_D_TERM(
+                        const float cf0 = (i == vlo.x && m[xlo](i-1,j,k) > 0) ? cf[xlo] : 0.0f;
+                        const float cf3 = (i == vhi.x && m[xhi](i+1,j,k) > 0) ? cf[xhi] : 0.0f;,
+                        const float cf1 = (j == vlo.y && m[ylo](i,j-1,k) > 0) ? cf[ylo] : 0.0f;
+                        const float cf4 = (j == vhi.y && m[yhi](i,j+1,k) > 0) ? cf[yhi] : 0.0f;,
+                        const float cf2 = (k == vlo.z && m[zlo](i,j,k-1) > 0) ? cf[zlo] : 0.0f;
+                        const float cf5 = (k == vhi.z && m[zhi](i,j,k+1) > 0) ? cf[zhi] : 0.0f;);
+
+                    const float gamma = a(i,j,k)
+                        AMREX_D_TERM(+ bX(i,j,k) + bX(i+1,j,k),
+                                     + bY(i,j,k) + bY(i,j+1,k),
+                                     + bZ(i,j,k) + bZ(i,j,k+1));
+
+                    const float g_m_d = gamma
+                        AMREX_D_TERM(- (bX(i,j,k)*cf0 + bX(i+1,j,k)*cf3),
+                                     - (bY(i,j,k)*cf1 + bY(i,j+1,k)*cf4),
+                                     - (bZ(i,j,k)*cf2 + bZ(i,j,k+1)*cf5));
+
+                    const float rho =
+                        AMREX_D_TERM(  bX(i,j,k)*phi(i-1,j,k,n) + bX(i+1,j,k)*phi(i+1,j,k,n),
+                                     + bY(i,j,k)*phi(i,j-1,k,n) + bY(i,j+1,k)*phi(i,j+1,k,n),
+                                     + bZ(i,j,k)*phi(i,j,k-1,n) + bZ(i,j,k+1)*phi(i,j,k+1,n));
+
+                    const float res = rhs(i,j,k,n) - (gamma*phi(i,j,k,n) - rho);
+                    phi(i,j,k,n) += omega/g_m_d * res;
+                }
+            }
+        }
+    }
+}
+
+}
+
 MLCellABecLap::MLCellABecLap ()
 {
 }
@@ -36,6 +125,204 @@ MLCellABecLap::update ()
     if (MLCellLinOp::needsUpdate()) MLCellLinOp::update();
 }
 
+bool
+MLCellABecLap::supportsSinglePrecisionCycle () const
+{
+#if (AMREX_SPACEDIM == 1)
+    return false;
+#else
+    return isCrossStencil() && m_geom[0][0].IsCartesian()
+        && m_smoother == SmootherType::Default && maxorder <= 5;
+#endif
+}
+
+void
+MLCellABecLap::prepareSinglePrecisionCycle ()
+{
+    BL_PROFILE("MLCellABecLap::prepareSinglePrecisionCycle()");
+
+    const int amrlev = 0;
+    const int nmglevs = m_num_mg_levels[amrlev];
+    const Real alpha = getAScalar();
+    const Real beta  = getBScalar();
+
+    m_a_single_scalar = static_cast<float>(alpha);
+    m_b_single_scalar.resize(nmglevs);
+    for (int mglev = 0; mglev < nmglevs; ++mglev) {
+        const Real* dxinv = m_geom[amrlev][mglev].InvCellSize();
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            m_b_single_scalar[mglev][idim] = static_cast<float>(beta*dxinv[idim]*dxinv[idim]);
+        }
+    }
+
+    // Operators without coefficient arrays (e.g., MLPoisson) only need the scalars.
+    const auto bcoefs0 = getBCoeffs(amrlev,0);
+    m_single_has_coeffs = (alpha != 0.0 && getACoeffs(amrlev,0) != nullptr);
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        m_single_has_coeffs = m_single_has_coeffs || bcoefs0[idim] != nullptr;
+    }
+    if (!m_single_has_coeffs) return;
+
+    // dst = fac*src, or fac if src is null
+    auto fill = [] (FloatMultiFab& dst, MultiFab const* src, float fac)
+    {
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        for (MFIter mfi(dst, true); mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mfi.tilebox();
+            if (src == nullptr) {
+                dst[mfi].setVal(fac, bx);
+                continue;
+            }
+            const auto len = amrex::length(bx);
+            const auto lo  = amrex::lbound(bx);
+            const auto d   = dst[mfi].view(lo);
+            const auto s   = (*src)[mfi].view(lo);
+            for         (int k = 0; k < len.z; ++k) {
+                for     (int j = 0; j < len.y; ++j) {
+                    AMREX_PRAGMA_SIMD
+                    for (int i = 0; i < len.x; ++i) {
+                        d(i,j,k) = fac*static_cast<float>(s(i,j,k));
+                    }
+                }
+            }
+        }
+    };
+
+    m_a_single.resize(nmglevs);
+    m_b_single.resize(nmglevs);
+    for (int mglev = 0; mglev < nmglevs; ++mglev)
+    {
+        const BoxArray& ba = m_grids[amrlev][mglev];
+        const DistributionMapping& dm = m_dmap[amrlev][mglev];
+
+        if (m_a_single[mglev].empty()) {
+            m_a_single[mglev].define(ba, dm, 1, 0);
+        }
+        fill(m_a_single[mglev], (alpha == 0.0) ? nullptr : getACoeffs(amrlev,mglev),
+             m_a_single_scalar);
+
+        const auto bcoefs = getBCoeffs(amrlev,mglev);
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
+        {
+            if (m_b_single[mglev][idim].empty()) {
+                m_b_single[mglev][idim].define(amrex::convert(ba, IntVect::TheDimensionVector(idim)),
+                                               dm, 1, 0);
+            }
+            fill(m_b_single[mglev][idim], bcoefs[idim], m_b_single_scalar[mglev][idim]);
+        }
+    }
+}
+
+void
+MLCellABecLap::FresidSingle (int amrlev, int mglev, FloatMultiFab& resid,
+                             const FloatMultiFab& sol, const FloatMultiFab& rhs) const
+{
+    BL_PROFILE("MLCellABecLap::FresidSingle()");
+    AMREX_ASSERT(amrlev == 0);
+
+    const int ncomp = getNComp();
+    const auto& bs = m_b_single_scalar[mglev];
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(resid, true); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+        const auto len = amrex::length(bx);
+        const auto lo  = amrex::lbound(bx);
+        const auto r   = resid[mfi].view(lo);
+        const auto x   = sol[mfi].view(lo);
+        const auto b   = rhs[mfi].view(lo);
+
+        if (m_single_has_coeffs)
+        {
+            abecResidSingle(len, ncomp, r, x, b, m_a_single[mglev][mfi].view(lo),
+                            AMREX_D_DECL(m_b_single[mglev][0][mfi].view(lo),
+                                         m_b_single[mglev][1][mfi].view(lo),
+                                         m_b_single[mglev][2][mfi].view(lo)));
+        }
+        else
+        {
+            abecResidSingle(len, ncomp, r, x, b, ConstCoefSingle{m_a_single_scalar},
+                            AMREX_D_DECL(ConstCoefSingle{bs[0]},
+                                         ConstCoefSingle{bs[1]},
+                                         ConstCoefSingle{bs[2]}));
+        }
+    }
+}
+
+void
+MLCellABecLap::FsmoothSingle (int amrlev, int mglev, FloatMultiFab& sol,
+                              const FloatMultiFab& rhs, int redblack) const
+{
+    BL_PROFILE("MLCellABecLap::FsmoothSingle()");
+    AMREX_ASSERT(amrlev == 0);
+
+#if (AMREX_SPACEDIM == 3)
+    // over-relaxation as in amrex_abec_gsrb
+    const float omega = 1.15f;
+#else
+    const float omega = 1.0f;
+#endif
+
+    const int ncomp = getNComp();
+    const auto& maskvals = m_maskvals[amrlev][mglev];
+    const auto& bs = m_b_single_scalar[mglev];
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(sol, MFItInfo().EnableTiling().SetDynamic(true)); mfi.isValid(); ++mfi)
+    {
+        const Box& bx  = mfi.tilebox();
+        const Box& vbx = mfi.validbox();
+        const auto len = amrex::length(bx);
+        const auto lo  = amrex::lbound(bx);
+
+        float cf[2*AMREX_SPACEDIM];
+        Array<FabView<int const>,2*AMREX_SPACEDIM> m;
+        for (OrientationIter oitr; oitr; ++oitr)
+        {
+            const Orientation ori = oitr();
+            Real c[4];
+            cf[ori] = (homogBCCoeffs(amrlev, mglev, mfi, ori, c) > 0)
+                ? static_cast<float>(c[0]) : 0.0f;
+            m[ori] = maskvals[ori][mfi].view(lo);
+        }
+
+        const auto vlo = amrex::lbound(vbx);
+        const auto vhi = amrex::ubound(vbx);
+        const Dim3 rvlo{vlo.x-lo.x, vlo.y-lo.y, vlo.z-lo.z};
+        const Dim3 rvhi{vhi.x-lo.x, vhi.y-lo.y, vhi.z-lo.z};
+
+        const auto phi = sol[mfi].view(lo);
+        const auto b   = rhs[mfi].view(lo);
+
+        if (m_single_has_coeffs)
+        {
+            abecGSRBSingle(lo, len, rvlo, rvhi, ncomp, redblack, omega, phi, b,
+                           m_a_single[mglev][mfi].view(lo),
+                           AMREX_D_DECL(m_b_single[mglev][0][mfi].view(lo),
+                                        m_b_single[mglev][1][mfi].view(lo),
+                                        m_b_single[mglev][2][mfi].view(lo)),
+                           cf, m);
+        }
+        else
+        {
+            abecGSRBSingle(lo, len, rvlo, rvhi, ncomp, redblack, omega, phi, b,
+                           ConstCoefSingle{m_a_single_scalar},
+                           AMREX_D_DECL(ConstCoefSingle{bs[0]},
+                                        ConstCoefSingle{bs[1]},
+                                        ConstCoefSingle{bs[2]}),
+                           cf, m);
+        }
+    }
+}
+
 void
 MLCellABecLap::getFluxes (const Vector<Array<MultiFab*,AMREX_SPACEDIM> >& a_flux,
                           const Vector<MultiFab*>& a_sol,
@@ -3,6 +3,8 @@
 #include <AMReX_MLLinOp_F.H>
 #include <AMReX_MG_F.H>
 #include <AMReX_MultiFabUtil.H>
+#include <cmath>
+#include <limits>
 #ifdef AMREX_USE_EB
 #include <AMReX_MLEBABecLap_F.H>
 #endif
@@ -344,12 +346,25 @@ MLCellLinOp::smooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs,
                      bool skip_fillboundary) const
 {
     BL_PROFILE("MLCellLinOp::smooth()");
-    for (int redblack = 0; redblack < 2; ++redblack)
+    if (m_smoother == SmootherType::L1Jacobi)
     {
-        applyBC(amrlev, mglev, sol, BCMode::Homogeneous, StateMode::Solution,
-                nullptr, skip_fillboundary);
-        Fsmooth(amrlev, mglev, sol, rhs, redblack);
-        skip_fillboundary = false;
+        AMREX_ASSERT(m_smoother_ready);
+        jacobiSmooth(amrlev, mglev, sol, rhs, skip_fillboundary);
+    }
+    else if (m_smoother == SmootherType::Chebyshev)
+    {
+        AMREX_ASSERT(m_smoother_ready);
+        chebyshevSmooth(amrlev, mglev, sol, rhs, skip_fillboundary);
+    }
+    else
+    {
+        for (int redblack = 0; redblack < 2; ++redblack)
+        {
+            applyBC(amrlev, mglev, sol, BCMode::Homogeneous, StateMode::Solution,
+                    nullptr, skip_fillboundary);
+            Fsmooth(amrlev, mglev, sol, rhs, redblack);
+            skip_fillboundary = false;
+        }
     }
 }
 
@@ -571,9 +586,9 @@ MLCellLinOp::compFlux (int amrlev, const Array<MultiFab*,AMREX_SPACEDIM>& fluxes
         for (MFIter mfi(sol, MFItInfo().EnableTiling().SetDynamic(true));  mfi.isValid(); ++mfi)
         {
             const Box& tbx = mfi.tilebox();
-            AMREX_D_TERM(flux[0].resize(amrex::surroundingNodes(tbx,0));,
-                         flux[1].resize(amrex::surroundingNodes(tbx,1));,
-                         flux[2].resize(amrex::surroundingNodes(tbx,2)););
+            AMREX_D_TERM(flux[0].resize(amrex::surroundingNodes(tbx,0),ncomp);,
+                         flux[1].resize(amrex::surroundingNodes(tbx,1),ncomp);,
+                         flux[2].resize(amrex::surroundingNodes(tbx,2),ncomp););
             FFlux(amrlev, mfi, pflux, sol[mfi], loc);
             for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
                 const Box& nbx = mfi.nodaltilebox(idim);
@@ -661,6 +676,631 @@ MLCellLinOp::prepareForSolve ()
             }
         }
     }
+
+    m_smoother_ready = false;
+}
+
+void
+MLCellLinOp::prepareSmoother ()
+{
+    if (m_smoother == SmootherType::Default || m_smoother_ready) return;
+
+    BL_PROFILE("MLCellLinOp::prepareSmoother()");
+
+    if (!isCrossStencil()) {
+        amrex::Abort("MLCellLinOp: smoother type not supported by this operator");
+    }
+
+    const bool l1 = (m_smoother == SmootherType::L1Jacobi);
+
+    m_smoother_invdiag.clear();
+    m_smoother_invdiag.resize(m_num_amr_levels);
+    m_cheby_lambda_max.clear();
+    m_cheby_lambda_max.resize(m_num_amr_levels);
+    const int ncomp = getNComp();
+    for (int amrlev = 0; amrlev < m_num_amr_levels; ++amrlev)
+    {
+        m_smoother_invdiag[amrlev].resize(m_num_mg_levels[amrlev]);
+        m_cheby_lambda_max[amrlev].resize(m_num_mg_levels[amrlev]);
+        for (int mglev = 0; mglev < m_num_mg_levels[amrlev]; ++mglev)
+        {
+            MultiFab& invdiag = m_smoother_invdiag[amrlev][mglev];
+            invdiag.define(m_grids[amrlev][mglev], m_dmap[amrlev][mglev], ncomp, 0,
+                           MFInfo(), *m_factory[amrlev][mglev]);
+            computeInvDiag(amrlev, mglev, invdiag, l1);
+
+            if (m_smoother == SmootherType::Chebyshev)
+            {
+                Vector<Real>& lambda_max = m_cheby_lambda_max[amrlev][mglev];
+                lambda_max = estimateLambdaMax(amrlev, mglev);
+                for (int n = 0; n < ncomp; ++n)
+                {
+                    // Power iterations underestimate the largest eigenvalue.
+                    lambda_max[n] *= 1.1;
+                    if (verbose >= 2) {
+                        amrex::Print() << "MLCellLinOp: AMR level " << amrlev << ", MG level " << mglev
+                                       << ", component " << n
+                                       << ", Chebyshev lambda_max = " << lambda_max[n] << "\n";
+                    }
+                }
+            }
+        }
+    }
+
+    m_smoother_ready = true;
+}
+
+void
+MLCellLinOp::computeInvDiag (int amrlev, int mglev, MultiFab& invdiag, bool l1) const
+{
+    BL_PROFILE("MLCellLinOp::computeInvDiag()");
+
+    // The diagonal, including the modification by the boundary
+    // conditions, is obtained by applying the operator to indicator
+    // functions of a coloring in which no two neighbors in the cross
+    // stencil share a color.  In each direction, a cell is colored by
+    // the parity of its index, except for the last cell of a periodic
+    // direction with an odd number of cells, which gets a third color.
+    // Summing over directions modulo 3 then gives neighbors different
+    // colors.  Assuming off-diagonal entries with the opposite sign of
+    // the diagonal, the l1 row sum is 2*D - A*1.
+
+    static constexpr int ncolors = 3;
+
+    const Geometry& geom = m_geom[amrlev][mglev];
+    const Box& domain = geom.Domain();
+    IntVect odd_periodic_hi(AMREX_D_DECL(std::numeric_limits<int>::max(),
+                                         std::numeric_limits<int>::max(),
+                                         std::numeric_limits<int>::max()));
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        if (geom.isPeriodic(idim) && domain.length(idim) % 2 == 1) {
+            odd_periodic_hi[idim] = domain.bigEnd(idim);
+        }
+    }
+    const auto color = [&odd_periodic_hi] (int i, int j, int k) -> int
+    {
+        const IntVect iv(AMREX_D_DECL(i,j,k));
+        int c = 0;
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            c += (iv[idim] == odd_periodic_hi[idim]) ? 2 : (iv[idim] & 1);
+        }
+        return c % ncolors;
+    };
+
+    const BoxArray& ba = m_grids[amrlev][mglev];
+    const DistributionMapping& dm = m_dmap[amrlev][mglev];
+    const int ncomp = getNComp();
+
+    MultiFab v (ba, dm, ncomp, 1, MFInfo(), *m_factory[amrlev][mglev]);
+    MultiFab Av(ba, dm, ncomp, 0, MFInfo(), *m_factory[amrlev][mglev]);
+
+    invdiag.setVal(0.0);
+
+    for (int ic = 0; ic <= ncolors; ++ic)
+    {
+        // ic == ncolors is for A*1.
+        if (ic == ncolors && !l1) break;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        for (MFIter mfi(v, true); mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mfi.tilebox();
+            const auto len = amrex::length(bx);
+            const auto lo  = amrex::lbound(bx);
+            const auto p   = v[mfi].view(lo);
+
+            for (int n = 0; n < ncomp; ++n) {
+                for         (int k = 0; k < len.z; ++k) {
+                    for     (int j = 0; j < len.y; ++j) {
+                        for (int i = 0; i < len.x; ++i) {
+                            p(i,j,k,n) = (ic == ncolors || color(i+lo.x,j+lo.y,k+lo.z) == ic)
+                                ? 1.0 : 0.0;
+                        }
+                    }
+                }
+            }
+        }
+
+        applyBC(amrlev, mglev, v, BCMode::Homogeneous, StateMode::Solution);
+        Fapply(amrlev, mglev, Av, v);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        for (MFIter mfi(invdiag, true); mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mfi.tilebox();
+            const auto len = amrex::length(bx);
+            const auto lo  = amrex::lbound(bx);
+            const auto  d  = invdiag[mfi].view(lo);
+            const auto av  = Av[mfi].view(lo);
+
+            for (int n = 0; n < ncomp; ++n) {
+                for         (int k = 0; k < len.z; ++k) {
+                    for     (int j = 0; j < len.y; ++j) {
+                        for (int i = 0; i < len.x; ++i) {
+                            if (ic == ncolors) {
+                                d(i,j,k,n) = 2.0*d(i,j,k,n) - av(i,j,k,n);
+                            } else if (color(i+lo.x,j+lo.y,k+lo.z) == ic) {
+                                d(i,j,k,n) = av(i,j,k,n);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(invdiag, true); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+        const auto len = amrex::length(bx);
+        const auto lo  = amrex::lbound(bx);
+        const auto  d  = invdiag[mfi].view(lo);
+
+        for (int n = 0; n < ncomp; ++n) {
+            for         (int k = 0; k < len.z; ++k) {
+                for     (int j = 0; j < len.y; ++j) {
+                    AMREX_PRAGMA_SIMD
+                    for (int i = 0; i < len.x; ++i) {
+                        d(i,j,k,n) = (d(i,j,k,n) != 0.0) ? 1.0/d(i,j,k,n) : 0.0;
+                    }
+                }
+            }
+        }
+    }
+}
+
+Vector<Real>
+MLCellLinOp::estimateLambdaMax (int amrlev, int mglev) const
+{
+    BL_PROFILE("MLCellLinOp::estimateLambdaMax()");
+
+    static constexpr int niters = 10;
+
+    const MultiFab& invdiag = m_smoother_invdiag[amrlev][mglev];
+    const BoxArray& ba = m_grids[amrlev][mglev];
+    const DistributionMapping& dm = m_dmap[amrlev][mglev];
+    const int ncomp = getNComp();
+
+    MultiFab v (ba, dm, ncomp, 1, MFInfo(), *m_factory[amrlev][mglev]);
+    MultiFab Av(ba, dm, ncomp, 0, MFInfo(), *m_factory[amrlev][mglev]);
+
+    // A deterministic pseudo-random starting vector that does not
+    // depend on the domain decomposition.  The largest eigenvalue
+    // belongs to the most oscillatory mode, so the vector is a
+    // perturbed checkerboard; a purely random one has too little of
+    // that mode on the coarse MG levels for 10 iterations.
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(v, true); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+        const auto len = amrex::length(bx);
+        const auto lo  = amrex::lbound(bx);
+        const auto p   = v[mfi].view(lo);
+
+        for (int n = 0; n < ncomp; ++n) {
+            for         (int k = 0; k < len.z; ++k) {
+                for     (int j = 0; j < len.y; ++j) {
+                    for (int i = 0; i < len.x; ++i) {
+                        const Real r = 43758.5453 * std::sin(12.9898*(i+lo.x) + 78.233*(j+lo.y)
+                                                             + 37.719*(k+lo.z));
+                        const Real sgn = (((i+lo.x+j+lo.y+k+lo.z) & 1) == 0) ? 1.0 : -1.0;
+                        p(i,j,k,n) = sgn * (r - std::floor(r) + 0.5);
+                    }
+                }
+            }
+        }
+    }
+
+    // Each component is normalized separately so that the estimate of
+    // D^{-1} A is obtained for every component.
+    Vector<Real> lambda(ncomp, 0.0);
+    Vector<Real> vnorm(ncomp);
+    for (int n = 0; n < ncomp; ++n) {
+        vnorm[n] = v.norm2(n);
+    }
+    for (int iter = 0; iter < niters; ++iter)
+    {
+        for (int n = 0; n < ncomp; ++n) {
+            v.mult((vnorm[n] > 0.0) ? 1.0/vnorm[n] : 0.0, n, 1, 0);
+        }
+        applyBC(amrlev, mglev, v, BCMode::Homogeneous, StateMode::Solution);
+        Fapply(amrlev, mglev, Av, v);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        for (MFIter mfi(Av, true); mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mfi.tilebox();
+            const auto len = amrex::length(bx);
+            const auto lo  = amrex::lbound(bx);
+            const auto av  = Av[mfi].view(lo);
+            const auto  d  = invdiag[mfi].view(lo);
+
+            for (int n = 0; n < ncomp; ++n) {
+                for         (int k = 0; k < len.z; ++k) {
+                    for     (int j = 0; j < len.y; ++j) {
+                        AMREX_PRAGMA_SIMD
+                        for (int i = 0; i < len.x; ++i) {
+                            av(i,j,k,n) *= d(i,j,k,n);
+                        }
+                    }
+                }
+            }
+        }
+
+        MultiFab::Copy(v, Av, 0, 0, ncomp, 0);
+        for (int n = 0; n < ncomp; ++n) {
+            vnorm[n] = v.norm2(n);
+            lambda[n] = vnorm[n];
+        }
+    }
+
+    return lambda;
+}
+
+void
+MLCellLinOp::jacobiSmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs,
+                           bool skip_fillboundary) const
+{
+    BL_PROFILE("MLCellLinOp::jacobiSmooth()");
+
+    const MultiFab& invdiag = m_smoother_invdiag[amrlev][mglev];
+    const int ncomp = getNComp();
+
+    MultiFab Ax(sol.boxArray(), sol.DistributionMap(), ncomp, 0, MFInfo(), *m_factory[amrlev][mglev]);
+
+    // Two sweeps have the same number of ghost cell exchanges as one
+    // red-black Gauss-Seidel sweep.
+    for (int sweep = 0; sweep < 2; ++sweep)
+    {
+        applyBC(amrlev, mglev, sol, BCMode::Homogeneous, StateMode::Solution,
+                nullptr, skip_fillboundary);
+        Fapply(amrlev, mglev, Ax, sol);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        for (MFIter mfi(Ax, true); mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mfi.tilebox();
+            const auto len = amrex::length(bx);
+            const auto lo  = amrex::lbound(bx);
+            const auto  x  = sol[mfi].view(lo);
+            const auto  b  = rhs[mfi].view(lo);
+            const auto ax  = Ax[mfi].view(lo);
+            const auto  d  = invdiag[mfi].view(lo);
+
+            for (int n = 0; n < ncomp; ++n) {
+                for         (int k = 0; k < len.z; ++k) {
+                    for     (int j = 0; j < len.y; ++j) {
+                        AMREX_PRAGMA_SIMD
+                        for (int i = 0; i < len.x; ++i) {
+                            x(i,j,k,n) += d(i,j,k,n) * (b(i,j,k,n) - ax(i,j,k,n));
+                        }
+                    }
+                }
+            }
+        }
+
+        skip_fillboundary = false;
+    }
+}
+
+void
+MLCellLinOp::chebyshevSmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs,
+                              bool skip_fillboundary) const
+{
+    BL_PROFILE("MLCellLinOp::chebyshevSmooth()");
+
+    const MultiFab& invdiag = m_smoother_invdiag[amrlev][mglev];
+    const int ncomp = getNComp();
+
+    MultiFab Ax(sol.boxArray(), sol.DistributionMap(), ncomp, 0, MFInfo(), *m_factory[amrlev][mglev]);
+    MultiFab  d(sol.boxArray(), sol.DistributionMap(), ncomp, 0, MFInfo(), *m_factory[amrlev][mglev]);
+
+    d.setVal(0.0);
+
+    // The eigenvalue bounds, and hence the coefficients, are per component.
+    const Vector<Real>& lambda_max = m_cheby_lambda_max[amrlev][mglev];
+    Vector<Real> delta(ncomp), sigma(ncomp), rho(ncomp), c_d(ncomp), c_r(ncomp);
+    for (int n = 0; n < ncomp; ++n)
+    {
+        const Real lambda_min = lambda_max[n] / m_cheby_eig_ratio;
+        const Real theta = 0.5*(lambda_max[n] + lambda_min);
+        delta[n] = 0.5*(lambda_max[n] - lambda_min);
+        sigma[n] = theta / delta[n];
+        rho[n] = 1.0/sigma[n];
+        // d_0 = D^{-1} r_0 / theta
+        c_d[n] = 0.0;
+        c_r[n] = 1.0/theta;
+    }
+
+    // d_k = rho_k rho_{k-1} d_{k-1} + 2 rho_k / delta D^{-1} r_k
+    for (int deg = 0; deg < m_cheby_degree; ++deg)
+    {
+        if (deg > 0) {
+            for (int n = 0; n < ncomp; ++n) {
+                const Real rho_new = 1.0/(2.0*sigma[n] - rho[n]);
+                c_d[n] = rho_new * rho[n];
+                c_r[n] = 2.0 * rho_new / delta[n];
+                rho[n] = rho_new;
+            }
+        }
+
+        applyBC(amrlev, mglev, sol, BCMode::Homogeneous, StateMode::Solution,
+                nullptr, skip_fillboundary);
+        Fapply(amrlev, mglev, Ax, sol);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        for (MFIter mfi(Ax, true); mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mfi.tilebox();
+            const auto len = amrex::length(bx);
+            const auto lo  = amrex::lbound(bx);
+            const auto  x  = sol[mfi].view(lo);
+            const auto  b  = rhs[mfi].view(lo);
+            const auto ax  = Ax[mfi].view(lo);
+            const auto  p  = d[mfi].view(lo);
+            const auto dinv = invdiag[mfi].view(lo);
+
+            for (int n = 0; n < ncomp; ++n) {
+                const Real cd = c_d[n];
+                const Real cr = c_r[n];
+                for         (int k = 0; k < len.z; ++k) {
+                    for     (int j = 0; j < len.y; ++j) {
+                        AMREX_PRAGMA_SIMD
+                        for (int i = 0; i < len.x; ++i) {
+                            p(i,j,k,n) = cd * p(i,j,k,n) + cr * dinv(i,j,k,n) * (b(i,j,k,n) - ax(i,j,k,n));
+                            x(i,j,k,n) += p(i,j,k,n);
+                        }
+                    }
+                }
+            }
+        }
+
+        skip_fillboundary = false;
+    }
+}
+
+void
+MLCellLinOp::restrictionSingle (int, int, FloatMultiFab& crse, FloatMultiFab& fine) const
+{
+    BL_PROFILE("MLCellLinOp::restrictionSingle()");
+
+    const int ncomp = getNComp();
+
+    // With agglomeration, the coarse MG grids are not the coarsened fine grids.
+    const BoxArray& cba = amrex::coarsen(fine.boxArray(), mg_coarsen_ratio);
+    const bool need_parallel_copy = cba != crse.boxArray()
+        || fine.DistributionMap() != crse.DistributionMap();
+    FloatMultiFab ctmp;
+    if (need_parallel_copy) {
+        ctmp.define(cba, fine.DistributionMap(), ncomp, 0);
+    }
+    FloatMultiFab& cmf = need_parallel_copy ? ctmp : crse;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(cmf, true); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+        const auto len = amrex::length(bx);
+        const auto c = cmf[mfi].view(amrex::lbound(bx));
+        const auto f = fine[mfi].view(amrex::lbound(amrex::refine(bx,mg_coarsen_ratio)));
+
+        for (int n = 0; n < ncomp; ++n) {
+            for         (int k = 0; k < len.z; ++k) {
+                for     (int j = 0; j < len.y; ++j) {
+                    AMREX_PRAGMA_SIMD
+                    for (int i = 0; i < len.x; ++i) {
+#if (AMREX_SPACEDIM == 3)
+                        c(i,j,k,n) = 0.125f*(f(2*i,2*j  ,2*k  ,n) + f(2*i+1,2*j  ,2*k  ,n)
+                                           + f(2*i,2*j+1,2*k  ,n) + f(2*i+1,2*j+1,2*k  ,n)
+                                           + f(2*i,2*j  ,2*k+1,n) + f(2*i+1,2*j  ,2*k+1,n)
+                                           + f(2*i,2*j+1,2*k+1,n) + f(2*i+1,2*j+1,2*k+1,n));
+#elif (AMREX_SPACEDIM == 2)
+                        c(i,j,k,n) = 0.25f*(f(2*i,2*j  ,0,n) + f(2*i+1,2*j  ,0,n)
+                                          + f(2*i,2*j+1,0,n) + f(2*i+1,2*j+1,0,n));
+#else
+                        c(i,j,k,n) = 0.5f*(f(2*i,0,0,n) + f(2*i+1,0,0,n));
+#endif
+                    }
+                }
+            }
+        }
+    }
+
+    if (need_parallel_copy) {
+        crse.ParallelCopy(ctmp);
+    }
+}
+
+void
+MLCellLinOp::interpolationSingle (int, int, FloatMultiFab& fine, const FloatMultiFab& crse) const
+{
+    BL_PROFILE("MLCellLinOp::interpolationSingle()");
+
+    const int ncomp = getNComp();
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(crse, true); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+        const auto len = amrex::length(bx);
+        const auto c = crse[mfi].view(amrex::lbound(bx));
+        const auto f = fine[mfi].view(amrex::lbound(amrex::refine(bx,mg_coarsen_ratio)));
+
+        for (int n = 0; n < ncomp; ++n) {
+            for         (int k = 0; k < len.z; ++k) {
+                for     (int j = 0; j < len.y; ++j) {
+                    AMREX_PRAGMA_SIMD
+                    for (int i = 0; i < len.x; ++i) {
+                        const float cv = c(i,j,k,n);
+#if (AMREX_SPACEDIM == 3)
+                        f(2*i,2*j  ,2*k  ,n) += cv;  f(2*i+1,2*j  ,2*k  ,n) += cv;
+                        f(2*i,2*j+1,2*k  ,n) += cv;  f(2*i+1,2*j+1,2*k  ,n) += cv;
+                        f(2*i,2*j  ,2*k+1,n) += cv;  f(2*i+1,2*j  ,2*k+1,n) += cv;
+                        f(2*i,2*j+1,2*k+1,n) += cv;  f(2*i+1,2*j+1,2*k+1,n) += cv;
+#elif (AMREX_SPACEDIM == 2)
+                        f(2*i,2*j  ,0,n) += cv;  f(2*i+1,2*j  ,0,n) += cv;
+                        f(2*i,2*j+1,0,n) += cv;  f(2*i+1,2*j+1,0,n) += cv;
+#else
+                        f(2*i,0,0,n) += cv;  f(2*i+1,0,0,n) += cv;
+#endif
+                    }
+                }
+            }
+        }
+    }
+}
+
+void
+MLCellLinOp::smoothSingle (int amrlev, int mglev, FloatMultiFab& sol, const FloatMultiFab& rhs,
+                           bool skip_fillboundary) const
+{
+    BL_PROFILE("MLCellLinOp::smoothSingle()");
+    for (int redblack = 0; redblack < 2; ++redblack)
+    {
+        applyBCSingle(amrlev, mglev, sol, skip_fillboundary);
+        FsmoothSingle(amrlev, mglev, sol, rhs, redblack);
+        skip_fillboundary = false;
+    }
+}
+
+void
+MLCellLinOp::correctionResidualSingle (int amrlev, int mglev, FloatMultiFab& resid,
+                                       FloatMultiFab& x, const FloatMultiFab& b) const
+{
+    BL_PROFILE("MLCellLinOp::correctionResidualSingle()");
+    applyBCSingle(amrlev, mglev, x);
+    FresidSingle(amrlev, mglev, resid, x, b);
+}
+
+int
+MLCellLinOp::homogBCCoeffs (int amrlev, int mglev, const MFIter& mfi, Orientation ori,
+                            Real* c) const
+{
+    const auto& bcondloc = *m_bcondloc[amrlev][mglev];
+    const int bct = bcondloc.bndryConds(mfi)[ori];
+
+    if (bct == AMREX_LO_NEUMANN)
+    {
+        c[0] = 1.0;
+        return 1;
+    }
+    else if (bct == AMREX_LO_REFLECT_ODD)
+    {
+        c[0] = -1.0;
+        return 1;
+    }
+    else if (bct == AMREX_LO_DIRICHLET)
+    {
+        // Polynomial through the boundary value (zero) at the face and
+        // the first lenx+1 interior cells, evaluated at the ghost cell.
+        const int idim = ori.coordDir();
+        const int lenx = std::min(mfi.validbox().length(idim)-1, maxorder-2);
+        AMREX_ASSERT(lenx <= 3);
+        const Real xInt = -0.5;
+        Real x[5];
+        x[0] = -bcondloc.bndryLocs(mfi)[ori] * m_geom[amrlev][mglev].InvCellSize(idim);
+        for (int m = 0; m <= lenx; ++m) {
+            x[m+1] = m + 0.5;
+        }
+        for (int m = 0; m <= lenx; ++m) {
+            Real num = 1.0, den = 1.0;
+            for (int q = 0; q < lenx+2; ++q) {
+                if (q != m+1) {
+                    num *= xInt - x[q];
+                    den *= x[m+1] - x[q];
+                }
+            }
+            c[m] = num/den;
+        }
+        return lenx+1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+void
+MLCellLinOp::applyBCSingle (int amrlev, int mglev, FloatMultiFab& in, bool skip_fillboundary) const
+{
+    BL_PROFILE("MLCellLinOp::applyBCSingle()");
+
+    const int ncomp = getNComp();
+    if (!skip_fillboundary) {
+        in.FillBoundary(0, ncomp, m_geom[amrlev][mglev].periodicity(), isCrossStencil());
+    }
+
+    const auto& maskvals = m_maskvals[amrlev][mglev];
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(in, MFItInfo().SetDynamic(true)); mfi.isValid(); ++mfi)
+    {
+        const Box& vbx = mfi.validbox();
+        const auto lo = amrex::lbound(vbx);
+        const auto p = in[mfi].view(lo);
+
+        for (OrientationIter oitr; oitr; ++oitr)
+        {
+            const Orientation ori = oitr();
+
+            Real rc[4];
+            const int nc = homogBCCoeffs(amrlev, mglev, mfi, ori, rc);
+            if (nc == 0) continue;
+            float c[4];
+            for (int q = 0; q < nc; ++q) {
+                c[q] = static_cast<float>(rc[q]);
+            }
+
+            // offset of the interior cells from the ghost cell
+            const int idim = ori.coordDir();
+            const int s = ori.isLow() ? 1 : -1;
+            const int di = (idim == 0) ? s : 0;
+            const int dj = (idim == 1) ? s : 0;
+            const int dk = (idim == 2) ? s : 0;
+
+            const Box& gbx = amrex::adjCell(vbx, ori);
+            const auto glo = amrex::lbound(gbx);
+            const auto ghi = amrex::ubound(gbx);
+            const auto m = maskvals[ori][mfi].view(lo);
+
+            for (int n = 0; n < ncomp; ++n) {
+                for         (int k = glo.z-lo.z; k <= ghi.z-lo.z; ++k) {
+                    for     (int j = glo.y-lo.y; j <= ghi.y-lo.y; ++j) {
+                        for (int i = glo.x-lo.x; i <= ghi.x-lo.x; ++i) {
+                            if (m(i,j,k) > 0) {
+                                float v = 0.0f;
+                                for (int q = 0; q < nc; ++q) {
+                                    v += c[q]*p(i+(q+1)*di,j+(q+1)*dj,k+(q+1)*dk,n);
+                                }
+                                p(i,j,k,n) = v;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
 }
 
 Real
@@ -3,6 +3,7 @@
 #include <AMReX_MultiFabUtil.H>
 #include <AMReX_EBMultiFabUtil.H>
 #include <AMReX_EBFArrayBox.H>
+#include <AMReX_SparseCutFab.H>
 
 #include <AMReX_MLEBABecLap_F.H>
 #include <AMReX_MLLinOp_F.H>
@@ -22,6 +23,16 @@
 
 namespace amrex {
 
+namespace {
+    // Copies the sparse cut-cell data of one fab to dst on bx grown by
+    // one cell, which is all the EB kernels read around bx.
+    void sparseToFab (FArrayBox& dst, const SparseCutFab& src, const Box& bx,
+                      const EBCellFlagFab& flags)
+    {
+        src.toFab(dst, amrex::grow(bx,1), flags);
+    }
+}
+
 MLEBABecLap::MLEBABecLap (const Vector<Geometry>& a_geom,
                           const Vector<BoxArray>& a_grids,
                           const Vector<DistributionMapping>& a_dmap,
@@ -61,12 +72,14 @@ MLEBABecLap::define (const Vector<Geometry>& a_geom,
     m_cc_mask.resize(m_num_amr_levels);
     m_eb_phi.resize(m_num_amr_levels);
     m_eb_b_coeffs.resize(m_num_amr_levels);
+    m_cut_stencil.resize(m_num_amr_levels);
     for (int amrlev = 0; amrlev < m_num_amr_levels; ++amrlev)
     {
         m_a_coeffs[amrlev].resize(m_num_mg_levels[amrlev]);
         m_b_coeffs[amrlev].resize(m_num_mg_levels[amrlev]);
         m_cc_mask[amrlev].resize(m_num_mg_levels[amrlev]);
         m_eb_b_coeffs[amrlev].resize(m_num_mg_levels[amrlev]);
+        m_cut_stencil[amrlev].resize(m_num_mg_levels[amrlev]);
         for (int mglev = 0; mglev < m_num_mg_levels[amrlev]; ++mglev)
         {
             m_a_coeffs[amrlev][mglev].define(m_grids[amrlev][mglev],
@@ -126,6 +139,7 @@ MLEBABecLap::setScalars (Real a, Real b)
 {
     m_a_scalar = a;
     m_b_scalar = b;
+    m_needs_update = true;
     if (a == 0.0)
     {
         for (int amrlev = 0; amrlev < m_num_amr_levels; ++amrlev)
@@ -192,6 +206,8 @@ MLEBABecLap::setEBDirichlet (int amrlev, const MultiFab& phi, const MultiFab& be
                                     BL_TO_FORTRAN_ANYD((*flags)[mfi]));
         }
     }
+
+    m_needs_update = true;
 }
 
 void
@@ -271,6 +287,108 @@ MLEBABecLap::averageDownCoeffsToCoarseAmrLevel (int flev)
     }
 }
 
+void
+MLEBABecLap::buildCutCellStencils ()
+{
+    BL_PROFILE("MLEBABecLap::buildCutCellStencils()");
+
+    const int is_eb_dirichlet = isEBDirichlet();
+    const int nc = m_cut_stencil_ncoef;
+
+    for (int amrlev = 0; amrlev < m_num_amr_levels; ++amrlev)
+    {
+        for (int mglev = 0; mglev < m_num_mg_levels[amrlev]; ++mglev)
+        {
+            auto factory = dynamic_cast<EBFArrayBoxFactory const*>(m_factory[amrlev][mglev].get());
+            if (factory == nullptr) {
+                m_cut_stencil[amrlev][mglev].reset();
+                continue;
+            }
+
+            m_cut_stencil[amrlev][mglev].reset(new LayoutData<CutCellStencil>(m_grids[amrlev][mglev],
+                                                                             m_dmap[amrlev][mglev]));
+            auto& stencil = *m_cut_stencil[amrlev][mglev];
+
+            AMREX_D_TERM(const MultiFab& bxcoef = m_b_coeffs[amrlev][mglev][0];,
+                         const MultiFab& bycoef = m_b_coeffs[amrlev][mglev][1];,
+                         const MultiFab& bzcoef = m_b_coeffs[amrlev][mglev][2];);
+            const iMultiFab& ccmask = m_cc_mask[amrlev][mglev];
+            const Real* dxinv = m_geom[amrlev][mglev].InvCellSize();
+
+            // The stencils are built from the sparse geometry data so that
+            // the dense cut-cell data are never needed on the MG levels.
+            const FabArray<EBCellFlagFab>& flags = factory->getMultiEBCellFlagFab();
+            const MultiFab& vfrac = factory->getVolFrac();
+            auto area = factory->getSparseAreaFrac();
+            auto fcent = factory->getSparseFaceCent();
+            const MultiSparseCutFab& barea = factory->getSparseBndryArea();
+            const MultiSparseCutFab& bcent = factory->getSparseBndryCent();
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+            {
+                Array<FArrayBox,AMREX_SPACEDIM> areafab, fcentfab;
+                FArrayBox bareafab, bcentfab;
+                FArrayBox foo(Box::TheUnitBox());
+
+                for (MFIter mfi(stencil, MFItInfo().SetDynamic(true)); mfi.isValid(); ++mfi)
+                {
+                    const Box& vbx = mfi.validbox();
+                    const EBCellFlagFab& flagfab = flags[mfi];
+                    CutCellStencil& s = stencil[mfi];
+
+                    if (flagfab.getType(vbx) != FabType::singlevalued) continue;
+
+                    for (BoxIterator bi(vbx); bi.ok(); ++bi)
+                    {
+                        const IntVect& iv = bi();
+                        if (flagfab(iv).isSingleValued()) {
+                            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                                s.cell.push_back(iv[idim]);
+                            }
+                        }
+                    }
+                    const int ncut = s.size();
+                    s.coef.resize(ncut*nc);
+
+                    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
+                    {
+                        const Box& fbx = amrex::surroundingNodes(vbx,idim);
+                        areafab[idim].resize(fbx, 1);
+                        (*area[idim])[mfi].copyTo(areafab[idim], fbx, flagfab);
+                        fcentfab[idim].resize(fbx, AMREX_SPACEDIM-1);
+                        (*fcent[idim])[mfi].copyTo(fcentfab[idim], fbx, flagfab);
+                    }
+                    bareafab.resize(vbx, 1);
+                    barea[mfi].copyTo(bareafab, vbx, flagfab);
+                    bcentfab.resize(vbx, AMREX_SPACEDIM);
+                    bcent[mfi].copyTo(bcentfab, vbx, flagfab);
+
+                    FArrayBox const& bebfab = (is_eb_dirichlet) ? (*m_eb_b_coeffs[amrlev][mglev])[mfi] : foo;
+
+                    amrex_mlebabeclap_stencil(ncut, s.cell.data(), s.coef.data(), nc,
+                                              AMREX_D_DECL(BL_TO_FORTRAN_ANYD(bxcoef[mfi]),
+                                                           BL_TO_FORTRAN_ANYD(bycoef[mfi]),
+                                                           BL_TO_FORTRAN_ANYD(bzcoef[mfi])),
+                                              BL_TO_FORTRAN_ANYD(ccmask[mfi]),
+                                              BL_TO_FORTRAN_ANYD(vfrac[mfi]),
+                                              AMREX_D_DECL(BL_TO_FORTRAN_ANYD(areafab[0]),
+                                                           BL_TO_FORTRAN_ANYD(areafab[1]),
+                                                           BL_TO_FORTRAN_ANYD(areafab[2])),
+                                              AMREX_D_DECL(BL_TO_FORTRAN_ANYD(fcentfab[0]),
+                                                           BL_TO_FORTRAN_ANYD(fcentfab[1]),
+                                                           BL_TO_FORTRAN_ANYD(fcentfab[2])),
+                                              BL_TO_FORTRAN_ANYD(bareafab),
+                                              BL_TO_FORTRAN_ANYD(bcentfab),
+                                              BL_TO_FORTRAN_ANYD(bebfab), is_eb_dirichlet,
+                                              dxinv, m_b_scalar);
+                }
+            }
+        }
+    }
+}
+
 void
 MLEBABecLap::prepareForSolve ()
 {
@@ -280,6 +398,8 @@ MLEBABecLap::prepareForSolve ()
     
     averageDownCoeffs();
 
+    buildCutCellStencils();
+
     if (m_eb_phi[0]) {
         for (int amrlev = m_num_amr_levels-1; amrlev > 0; --amrlev) {
             amrex::EB_average_down_boundaries(*m_eb_phi[amrlev], *m_eb_phi[amrlev-1],
@@ -323,19 +443,13 @@ MLEBABecLap::Fapply (int amrlev, int mglev, MultiFab& out, const MultiFab& in) c
     AMREX_D_TERM(const MultiFab& bxcoef = m_b_coeffs[amrlev][mglev][0];,
                  const MultiFab& bycoef = m_b_coeffs[amrlev][mglev][1];,
                  const MultiFab& bzcoef = m_b_coeffs[amrlev][mglev][2];);
-    const iMultiFab& ccmask = m_cc_mask[amrlev][mglev];
     
     const Real* dxinv = m_geom[amrlev][mglev].InvCellSize();
 
     auto factory = dynamic_cast<EBFArrayBoxFactory const*>(m_factory[amrlev][mglev].get());
     const FabArray<EBCellFlagFab>* flags = (factory) ? &(factory->getMultiEBCellFlagFab()) : nullptr;
-    const MultiFab* vfrac = (factory) ? &(factory->getVolFrac()) : nullptr;
-    auto area = (factory) ? factory->getAreaFrac()
-        : Array<const MultiCutFab*,AMREX_SPACEDIM>{AMREX_D_DECL(nullptr,nullptr,nullptr)};
-    auto fcent = (factory) ? factory->getFaceCent()
-        : Array<const MultiCutFab*,AMREX_SPACEDIM>{AMREX_D_DECL(nullptr,nullptr,nullptr)};
-    const MultiCutFab* barea = (factory) ? &(factory->getBndryArea()) : nullptr;
-    const MultiCutFab* bcent = (factory) ? &(factory->getBndryCent()) : nullptr;
+    const auto* stencil = m_cut_stencil[amrlev][mglev].get();
+    const int nc = m_cut_stencil_ncoef;
 
     const int is_eb_dirichlet = isEBDirichlet();
     FArrayBox foo(Box::TheUnitBox());
@@ -365,10 +479,10 @@ MLEBABecLap::Fapply (int amrlev, int mglev, MultiFab& out, const MultiFab& in) c
                                   AMREX_D_DECL(BL_TO_FORTRAN_ANYD(bxfab),
                                                BL_TO_FORTRAN_ANYD(byfab),
                                                BL_TO_FORTRAN_ANYD(bzfab)),
-                                  dxinv, m_a_scalar, m_b_scalar);
+                                  dxinv, m_a_scalar, m_b_scalar, 1);
         } else {
 
-            FArrayBox const& bebfab = (is_eb_dirichlet) ? (*m_eb_b_coeffs[amrlev][mglev])[mfi] : foo;
+            const CutCellStencil& s = (*stencil)[mfi];
             FArrayBox const& phiebfab = (is_eb_dirichlet && m_is_eb_inhomog) ? (*m_eb_phi[amrlev])[mfi] : foo;
 
             amrex_mlebabeclap_adotx(BL_TO_FORTRAN_BOX(bx),
@@ -378,19 +492,9 @@ MLEBABecLap::Fapply (int amrlev, int mglev, MultiFab& out, const MultiFab& in) c
                                     AMREX_D_DECL(BL_TO_FORTRAN_ANYD(bxfab),
                                                  BL_TO_FORTRAN_ANYD(byfab),
                                                  BL_TO_FORTRAN_ANYD(bzfab)),
-                                    BL_TO_FORTRAN_ANYD(ccmask[mfi]),
                                     BL_TO_FORTRAN_ANYD((*flags)[mfi]),
-                                    BL_TO_FORTRAN_ANYD((*vfrac)[mfi]),
-                                    AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*area[0])[mfi]),
-                                                 BL_TO_FORTRAN_ANYD((*area[1])[mfi]),
-                                                 BL_TO_FORTRAN_ANYD((*area[2])[mfi])),
-                                    AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*fcent[0])[mfi]),
-                                                 BL_TO_FORTRAN_ANYD((*fcent[1])[mfi]),
-                                                 BL_TO_FORTRAN_ANYD((*fcent[2])[mfi])),
-                                    BL_TO_FORTRAN_ANYD((*barea)[mfi]),
-                                    BL_TO_FORTRAN_ANYD((*bcent)[mfi]),
-                                    BL_TO_FORTRAN_ANYD(bebfab), is_eb_dirichlet,
-                                    BL_TO_FORTRAN_ANYD(phiebfab), m_is_eb_inhomog,
+                                    s.size(), s.cell.data(), s.coef.data(), nc,
+                                    BL_TO_FORTRAN_ANYD(phiebfab), is_eb_dirichlet && m_is_eb_inhomog,
                                     dxinv, m_a_scalar, m_b_scalar);
         }
     }
@@ -405,7 +509,6 @@ MLEBABecLap::Fsmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs,
     AMREX_D_TERM(const MultiFab& bxcoef = m_b_coeffs[amrlev][mglev][0];,
                  const MultiFab& bycoef = m_b_coeffs[amrlev][mglev][1];,
                  const MultiFab& bzcoef = m_b_coeffs[amrlev][mglev][2];);
-    const iMultiFab& ccmask = m_cc_mask[amrlev][mglev];
     const auto& undrrelxr = m_undrrelxr[amrlev][mglev];
     const auto& maskvals  = m_maskvals [amrlev][mglev];
 
@@ -439,16 +542,8 @@ MLEBABecLap::Fsmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs,
 
     auto factory = dynamic_cast<EBFArrayBoxFactory const*>(m_factory[amrlev][mglev].get());
     const FabArray<EBCellFlagFab>* flags = (factory) ? &(factory->getMultiEBCellFlagFab()) : nullptr;
-    const MultiFab* vfrac = (factory) ? &(factory->getVolFrac()) : nullptr;
-    auto area = (factory) ? factory->getAreaFrac()
-        : Array<const MultiCutFab*,AMREX_SPACEDIM>{AMREX_D_DECL(nullptr,nullptr,nullptr)};
-    auto fcent = (factory) ? factory->getFaceCent()
-        : Array<const MultiCutFab*,AMREX_SPACEDIM>{AMREX_D_DECL(nullptr,nullptr,nullptr)};
-    const MultiCutFab* barea = (factory) ? &(factory->getBndryArea()) : nullptr;
-    const MultiCutFab* bcent = (factory) ? &(factory->getBndryCent()) : nullptr;
-
-    const int is_eb_dirichlet = isEBDirichlet();
-    FArrayBox foo(Box::TheUnitBox());
+    const auto* stencil = m_cut_stencil[amrlev][mglev].get();
+    const int ncoef = m_cut_stencil_ncoef;
 
 #ifdef _OPENMP
 #pragma omp parallel
@@ -554,7 +649,7 @@ MLEBABecLap::Fsmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs,
         }
         else
         {
-            FArrayBox const& bebfab = (is_eb_dirichlet) ? (*m_eb_b_coeffs[amrlev][mglev])[mfi] : foo;
+            const CutCellStencil& s = (*stencil)[mfi];
 
             amrex_mlebabeclap_gsrb(BL_TO_FORTRAN_BOX(tbx),
                                    BL_TO_FORTRAN_ANYD(solnfab),
@@ -563,7 +658,6 @@ MLEBABecLap::Fsmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs,
                                    AMREX_D_DECL(BL_TO_FORTRAN_ANYD(bxfab),
                                                 BL_TO_FORTRAN_ANYD(byfab),
                                                 BL_TO_FORTRAN_ANYD(bzfab)),
-                                   BL_TO_FORTRAN_ANYD(ccmask[mfi]),
                                    AMREX_D_DECL(BL_TO_FORTRAN_ANYD(m0),
                                                 BL_TO_FORTRAN_ANYD(m2),
                                                 BL_TO_FORTRAN_ANYD(m4)),
@@ -577,16 +671,7 @@ MLEBABecLap::Fsmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs,
                                                 BL_TO_FORTRAN_ANYD(f3fab),
                                                 BL_TO_FORTRAN_ANYD(f5fab)),
                                    BL_TO_FORTRAN_ANYD((*flags)[mfi]),
-                                   BL_TO_FORTRAN_ANYD((*vfrac)[mfi]),
-                                   AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*area[0])[mfi]),
-                                                BL_TO_FORTRAN_ANYD((*area[1])[mfi]),
-                                                BL_TO_FORTRAN_ANYD((*area[2])[mfi])),
-                                   AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*fcent[0])[mfi]),
-                                                BL_TO_FORTRAN_ANYD((*fcent[1])[mfi]),
-                                                BL_TO_FORTRAN_ANYD((*fcent[2])[mfi])),
-                                   BL_TO_FORTRAN_ANYD((*barea)[mfi]),
-                                   BL_TO_FORTRAN_ANYD((*bcent)[mfi]),
-                                   BL_TO_FORTRAN_ANYD(bebfab), is_eb_dirichlet,
+                                   s.size(), s.cell.data(), s.coef.data(), ncoef,
                                    dxinv, m_a_scalar, m_b_scalar, redblack);
         }
     }
@@ -624,30 +709,38 @@ MLEBABecLap::FFlux (int amrlev, const MFIter& mfi, const Array<FArrayBox*,AMREX_
                              AMREX_D_DECL(BL_TO_FORTRAN_ANYD(bx),
                                           BL_TO_FORTRAN_ANYD(by),
                                           BL_TO_FORTRAN_ANYD(bz)),
-                             dxinv, m_b_scalar, face_only);
+                             dxinv, m_b_scalar, face_only, 1);
         if (fabtyp != FabType::regular && !face_only) {
-            const auto& area = factory->getAreaFrac();
+            const auto& area = factory->getSparseAreaFrac();
+            FArrayBox areafab;
             for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
                 const Box& fbx = amrex::surroundingNodes(box,idim);
+                sparseToFab(areafab, (*area[idim])[mfi], fbx, (*flags)[mfi]);
                 amrex_eb_set_covered_faces(BL_TO_FORTRAN_BOX(fbx),
                                            BL_TO_FORTRAN_ANYD(*flux[idim]),
-                                           BL_TO_FORTRAN_ANYD((*area[idim])[mfi]));
+                                           BL_TO_FORTRAN_ANYD(areafab));
             }
         }
     } else {               
-        const auto& area = factory->getAreaFrac();
-        const auto& fcent = factory->getFaceCent();
+        const auto& area = factory->getSparseAreaFrac();
+        const auto& fcent = factory->getSparseFaceCent();
+        Array<FArrayBox,AMREX_SPACEDIM> areafab, fcentfab;
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            const Box& fbx = amrex::surroundingNodes(box,idim);
+            sparseToFab(areafab[idim], (*area[idim])[mfi], fbx, (*flags)[mfi]);
+            sparseToFab(fcentfab[idim], (*fcent[idim])[mfi], fbx, (*flags)[mfi]);
+        }
 
         amrex_mlebabeclap_flux(BL_TO_FORTRAN_BOX(box), 
                                AMREX_D_DECL(BL_TO_FORTRAN_ANYD(*flux[0]),
                                             BL_TO_FORTRAN_ANYD(*flux[1]), 
                                             BL_TO_FORTRAN_ANYD(*flux[2])),
-                               AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*area[0])[mfi]), 
-                                            BL_TO_FORTRAN_ANYD((*area[1])[mfi]),
-                                            BL_TO_FORTRAN_ANYD((*area[2])[mfi])),
-                               AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*fcent[0])[mfi]),
-                                            BL_TO_FORTRAN_ANYD((*fcent[1])[mfi]),
-                                            BL_TO_FORTRAN_ANYD((*fcent[2])[mfi])),
+                               AMREX_D_DECL(BL_TO_FORTRAN_ANYD(areafab[0]), 
+                                            BL_TO_FORTRAN_ANYD(areafab[1]),
+                                            BL_TO_FORTRAN_ANYD(areafab[2])),
+                               AMREX_D_DECL(BL_TO_FORTRAN_ANYD(fcentfab[0]),
+                                            BL_TO_FORTRAN_ANYD(fcentfab[1]),
+                                            BL_TO_FORTRAN_ANYD(fcentfab[2])),
                                BL_TO_FORTRAN_ANYD(sol),
                                AMREX_D_DECL(BL_TO_FORTRAN_ANYD(bx),
                                             BL_TO_FORTRAN_ANYD(by),
@@ -674,14 +767,16 @@ MLEBABecLap::compGrad (int amrlev, const Array<MultiFab*,AMREX_SPACEDIM>& grad,
 
     auto factory = dynamic_cast<EBFArrayBoxFactory const*>(m_factory[amrlev][mglev].get()); 
     const FabArray<EBCellFlagFab>* flags = (factory) ? &(factory->getMultiEBCellFlagFab()) : nullptr; 
-    auto area = (factory) ? factory->getAreaFrac() : 
-        Array<const MultiCutFab*, AMREX_SPACEDIM>{AMREX_D_DECL(nullptr, nullptr, nullptr)}; 
-    auto fcent = (factory) ? factory->getFaceCent():
-        Array<const MultiCutFab*, AMREX_SPACEDIM>{AMREX_D_DECL(nullptr, nullptr, nullptr)}; 
+    auto area = (factory) ? factory->getSparseAreaFrac() : 
+        Array<const MultiSparseCutFab*, AMREX_SPACEDIM>{AMREX_D_DECL(nullptr, nullptr, nullptr)}; 
+    auto fcent = (factory) ? factory->getSparseFaceCent():
+        Array<const MultiSparseCutFab*, AMREX_SPACEDIM>{AMREX_D_DECL(nullptr, nullptr, nullptr)}; 
 
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
+    {
+    Array<FArrayBox,AMREX_SPACEDIM> areafab, fcentfab;
     for (MFIter mfi(sol, MFItInfo().EnableTiling().SetDynamic(true)); mfi.isValid(); ++mfi)
     {
         const Box& box = mfi.tilebox(); 
@@ -704,12 +799,17 @@ MLEBABecLap::compGrad (int amrlev, const Array<MultiFab*,AMREX_SPACEDIM>& grad,
                                dxinv);
             if (fabtyp != FabType::regular) {
                 for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                    sparseToFab(areafab[idim], (*area[idim])[mfi], fbx[idim], (*flags)[mfi]);
                     amrex_eb_set_covered_faces(BL_TO_FORTRAN_BOX(fbx[idim]),
                                                BL_TO_FORTRAN_ANYD((*grad[idim])[mfi]),
-                                               BL_TO_FORTRAN_ANYD((*area[idim])[mfi]));
+                                               BL_TO_FORTRAN_ANYD(areafab[idim]));
                 }
             }
         } else {
+           for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+               sparseToFab(areafab[idim], (*area[idim])[mfi], fbx[idim], (*flags)[mfi]);
+               sparseToFab(fcentfab[idim], (*fcent[idim])[mfi], fbx[idim], (*flags)[mfi]);
+           }
            amrex_mlebabeclap_grad(AMREX_D_DECL(BL_TO_FORTRAN_BOX(fbx[0]),
                                                BL_TO_FORTRAN_BOX(fbx[1]),
                                                BL_TO_FORTRAN_BOX(fbx[2])),
@@ -717,17 +817,18 @@ MLEBABecLap::compGrad (int amrlev, const Array<MultiFab*,AMREX_SPACEDIM>& grad,
                                   AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*grad[0])[mfi]),
                                                BL_TO_FORTRAN_ANYD((*grad[1])[mfi]),
                                                BL_TO_FORTRAN_ANYD((*grad[2])[mfi])),
-                                  AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*area[0])[mfi]),
-                                               BL_TO_FORTRAN_ANYD((*area[1])[mfi]),
-                                               BL_TO_FORTRAN_ANYD((*area[2])[mfi])),
-                                  AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*fcent[0])[mfi]),
-                                               BL_TO_FORTRAN_ANYD((*fcent[1])[mfi]),
-                                               BL_TO_FORTRAN_ANYD((*fcent[2])[mfi])),
+                                  AMREX_D_DECL(BL_TO_FORTRAN_ANYD(areafab[0]),
+                                               BL_TO_FORTRAN_ANYD(areafab[1]),
+                                               BL_TO_FORTRAN_ANYD(areafab[2])),
+                                  AMREX_D_DECL(BL_TO_FORTRAN_ANYD(fcentfab[0]),
+                                               BL_TO_FORTRAN_ANYD(fcentfab[1]),
+                                               BL_TO_FORTRAN_ANYD(fcentfab[2])),
                                   BL_TO_FORTRAN_ANYD(ccmask[mfi]),
                                   BL_TO_FORTRAN_ANYD((*flags)[mfi]), dxinv);
 
         }
     }
+    }
 }
 
 void
@@ -744,12 +845,12 @@ MLEBABecLap::normalize (int amrlev, int mglev, MultiFab& mf) const
     auto factory = dynamic_cast<EBFArrayBoxFactory const*>(m_factory[amrlev][mglev].get());
     const FabArray<EBCellFlagFab>* flags = (factory) ? &(factory->getMultiEBCellFlagFab()) : nullptr;
     const MultiFab* vfrac = (factory) ? &(factory->getVolFrac()) : nullptr;
-    auto area = (factory) ? factory->getAreaFrac()
-        : Array<const MultiCutFab*,AMREX_SPACEDIM>{AMREX_D_DECL(nullptr,nullptr,nullptr)};
-    auto fcent = (factory) ? factory->getFaceCent()
-        : Array<const MultiCutFab*,AMREX_SPACEDIM>{AMREX_D_DECL(nullptr,nullptr,nullptr)};
-    const MultiCutFab* barea = (factory) ? &(factory->getBndryArea()) : nullptr;
-    const MultiCutFab* bcent = (factory) ? &(factory->getBndryCent()) : nullptr;
+    auto area = (factory) ? factory->getSparseAreaFrac()
+        : Array<const MultiSparseCutFab*,AMREX_SPACEDIM>{AMREX_D_DECL(nullptr,nullptr,nullptr)};
+    auto fcent = (factory) ? factory->getSparseFaceCent()
+        : Array<const MultiSparseCutFab*,AMREX_SPACEDIM>{AMREX_D_DECL(nullptr,nullptr,nullptr)};
+    const MultiSparseCutFab* barea = (factory) ? &(factory->getSparseBndryArea()) : nullptr;
+    const MultiSparseCutFab* bcent = (factory) ? &(factory->getSparseBndryCent()) : nullptr;
 
     const int is_eb_dirichlet = isEBDirichlet();
     FArrayBox foo(Box::TheUnitBox());
@@ -757,6 +858,9 @@ MLEBABecLap::normalize (int amrlev, int mglev, MultiFab& mf) const
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
+    {
+    Array<FArrayBox,AMREX_SPACEDIM> areafab, fcentfab;
+    FArrayBox bareafab, bcentfab;
     for (MFIter mfi(mf, true); mfi.isValid(); ++mfi)
     {
         const Box& bx = mfi.tilebox();
@@ -776,12 +880,21 @@ MLEBABecLap::normalize (int amrlev, int mglev, MultiFab& mf) const
                                       AMREX_D_DECL(BL_TO_FORTRAN_ANYD(bxfab),
                                                    BL_TO_FORTRAN_ANYD(byfab),
                                                    BL_TO_FORTRAN_ANYD(bzfab)),
-                                      dxinv, m_a_scalar, m_b_scalar);
+                                      dxinv, m_a_scalar, m_b_scalar, 1);
         }
         else if (fabtyp == FabType::singlevalued)
         {
             FArrayBox const& bebfab = (is_eb_dirichlet) ? (*m_eb_b_coeffs[amrlev][mglev])[mfi] : foo;
 
+            const EBCellFlagFab& flagfab = (*flags)[mfi];
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                const Box& fbx = amrex::surroundingNodes(bx,idim);
+                sparseToFab(areafab[idim], (*area[idim])[mfi], fbx, flagfab);
+                sparseToFab(fcentfab[idim], (*fcent[idim])[mfi], fbx, flagfab);
+            }
+            sparseToFab(bareafab, (*barea)[mfi], bx, flagfab);
+            sparseToFab(bcentfab, (*bcent)[mfi], bx, flagfab);
+
             amrex_mlebabeclap_normalize(BL_TO_FORTRAN_BOX(bx),
                                         BL_TO_FORTRAN_ANYD(fab),
                                         BL_TO_FORTRAN_ANYD(afab),
@@ -791,19 +904,20 @@ MLEBABecLap::normalize (int amrlev, int mglev, MultiFab& mf) const
                                         BL_TO_FORTRAN_ANYD(ccmask[mfi]),
                                         BL_TO_FORTRAN_ANYD((*flags)[mfi]),
                                         BL_TO_FORTRAN_ANYD((*vfrac)[mfi]),
-                                        AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*area[0])[mfi]),
-                                                     BL_TO_FORTRAN_ANYD((*area[1])[mfi]),
-                                                     BL_TO_FORTRAN_ANYD((*area[2])[mfi])),
-                                        AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*fcent[0])[mfi]),
-                                                     BL_TO_FORTRAN_ANYD((*fcent[1])[mfi]),
-                                                     BL_TO_FORTRAN_ANYD((*fcent[2])[mfi])),
-                                        BL_TO_FORTRAN_ANYD((*barea)[mfi]),
-                                        BL_TO_FORTRAN_ANYD((*bcent)[mfi]),
+                                        AMREX_D_DECL(BL_TO_FORTRAN_ANYD(areafab[0]),
+                                                     BL_TO_FORTRAN_ANYD(areafab[1]),
+                                                     BL_TO_FORTRAN_ANYD(areafab[2])),
+                                        AMREX_D_DECL(BL_TO_FORTRAN_ANYD(fcentfab[0]),
+                                                     BL_TO_FORTRAN_ANYD(fcentfab[1]),
+                                                     BL_TO_FORTRAN_ANYD(fcentfab[2])),
+                                        BL_TO_FORTRAN_ANYD(bareafab),
+                                        BL_TO_FORTRAN_ANYD(bcentfab),
                                         BL_TO_FORTRAN_ANYD(bebfab),
                                         is_eb_dirichlet,
                                         dxinv, m_a_scalar, m_b_scalar);
         }
     }
+    }
 }
 
 void
@@ -888,8 +1002,8 @@ MLEBABecLap::applyBC (int amrlev, int mglev, MultiFab& in, BCMode bc_mode, State
     
     auto factory = dynamic_cast<EBFArrayBoxFactory const*>(m_factory[amrlev][mglev].get());
     const FabArray<EBCellFlagFab>* flags = (factory) ? &(factory->getMultiEBCellFlagFab()) : nullptr;
-    auto area = (factory) ? factory->getAreaFrac()
-        : Array<const MultiCutFab*,AMREX_SPACEDIM>{AMREX_D_DECL(nullptr,nullptr,nullptr)};
+    auto area = (factory) ? factory->getSparseAreaFrac()
+        : Array<const MultiSparseCutFab*,AMREX_SPACEDIM>{AMREX_D_DECL(nullptr,nullptr,nullptr)};
     
     FArrayBox foo(Box::TheUnitBox(),ncomp);
     foo.setVal(10.0);
@@ -897,12 +1011,21 @@ MLEBABecLap::applyBC (int amrlev, int mglev, MultiFab& in, BCMode bc_mode, State
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
+    {
+    Array<FArrayBox,AMREX_SPACEDIM> areafab;
     for (MFIter mfi(in, MFItInfo().SetDynamic(true)); mfi.isValid(); ++mfi)
     {
         const Box& vbx   = mfi.validbox();
         FArrayBox& iofab = in[mfi];
 
         auto fabtyp = (flags) ? (*flags)[mfi].getType(vbx) : FabType::regular;
+        if (fabtyp == FabType::singlevalued)
+        {
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                sparseToFab(areafab[idim], (*area[idim])[mfi],
+                            amrex::surroundingNodes(vbx,idim), (*flags)[mfi]);
+            }
+        }
         if (fabtyp != FabType::covered)
         {
             const RealTuple & bdl = bcondloc.bndryLocs(mfi);
@@ -934,9 +1057,9 @@ MLEBABecLap::applyBC (int amrlev, int mglev, MultiFab& in, BCMode bc_mode, State
                     amrex_mlebabeclap_apply_bc(BL_TO_FORTRAN_BOX(vbx),
                                                BL_TO_FORTRAN_ANYD(iofab),
                                                BL_TO_FORTRAN_ANYD((*flags)[mfi]),
-                                               AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*area[0])[mfi]),
-                                                            BL_TO_FORTRAN_ANYD((*area[1])[mfi]),
-                                                            BL_TO_FORTRAN_ANYD((*area[2])[mfi])),
+                                               AMREX_D_DECL(BL_TO_FORTRAN_ANYD(areafab[0]),
+                                                            BL_TO_FORTRAN_ANYD(areafab[1]),
+                                                            BL_TO_FORTRAN_ANYD(areafab[2])),
                                                BL_TO_FORTRAN_ANYD(ccmask[mfi]),
                                                cdr, bct, bcl,
                                                BL_TO_FORTRAN_ANYD(fsfab),
@@ -945,6 +1068,7 @@ MLEBABecLap::applyBC (int amrlev, int mglev, MultiFab& in, BCMode bc_mode, State
             }
         }
     }
+    }
 }
 
 void
@@ -963,6 +1087,8 @@ MLEBABecLap::update ()
 
     averageDownCoeffs();
 
+    buildCutCellStencils();
+
     m_is_singular.clear();
     m_is_singular.resize(m_num_amr_levels, false);
     auto itlo = std::find(m_lobc.begin(), m_lobc.end(), BCType::Dirichlet);
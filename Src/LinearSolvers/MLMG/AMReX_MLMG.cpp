@@ -40,6 +40,64 @@
 
 namespace amrex {
 
+namespace {
+
+// Copy the valid region of src to dst, converting between float and double.
+template <class DFAB, class SFAB>
+void convertCopy (FabArray<DFAB>& dst, const FabArray<SFAB>& src, int ncomp)
+{
+    using T = typename DFAB::value_type;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(dst, true); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+        const auto len = amrex::length(bx);
+        const auto lo  = amrex::lbound(bx);
+        const auto d   = dst[mfi].view(lo);
+        const auto s   = src[mfi].view(lo);
+        for (int n = 0; n < ncomp; ++n) {
+            for         (int k = 0; k < len.z; ++k) {
+                for     (int j = 0; j < len.y; ++j) {
+                    AMREX_PRAGMA_SIMD
+                    for (int i = 0; i < len.x; ++i) {
+                        d(i,j,k,n) = static_cast<T>(s(i,j,k,n));
+                    }
+                }
+            }
+        }
+    }
+}
+
+// dst += src on the valid region
+void addSingle (MLLinOp::FloatMultiFab& dst, const MLLinOp::FloatMultiFab& src, int ncomp)
+{
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(dst, true); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+        const auto len = amrex::length(bx);
+        const auto lo  = amrex::lbound(bx);
+        const auto d   = dst[mfi].view(lo);
+        const auto s   = src[mfi].view(lo);
+        for (int n = 0; n < ncomp; ++n) {
+            for         (int k = 0; k < len.z; ++k) {
+                for     (int j = 0; j < len.y; ++j) {
+                    AMREX_PRAGMA_SIMD
+                    for (int i = 0; i < len.x; ++i) {
+                        d(i,j,k,n) += s(i,j,k,n);
+                    }
+                }
+            }
+        }
+    }
+}
+
+}
+
 MLMG::MLMG (MLLinOp& a_lp)
     : linop(a_lp),
       namrlevs(a_lp.NAMRLevels()),
@@ -56,6 +114,10 @@ MLMG::solve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab const*>& a_rh
     BL_PROFILE_REGION("MLMG::solve()");
     BL_PROFILE("MLMG::solve()");
 
+    if (krylov_solver != KrylovSolver::none && !linop.m_parent) {
+        return solveKrylov(a_sol, a_rhs, a_tol_rel, a_tol_abs);
+    }
+
     if (bottom_solver == BottomSolver::hypre) {
         int mo = linop.getMaxOrder();
         linop.setMaxOrder(std::min(3,mo));  // maxorder = 4 not supported
@@ -73,38 +135,74 @@ MLMG::solve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab const*>& a_rh
 
     int ncomp = linop.getNComp();
 
+    // All norms are kept per component so that each right-hand side of a
+    // multi-component solve is tested against its own tolerance.
     bool local = true;
-    Real resnorm0 = MLResNormInf(finest_amr_lev, local); 
-    Real rhsnorm0 = MLRhsNormInf(local); 
+    Vector<Real> resnorm0 = MLResNormInf(finest_amr_lev, local);
+    Vector<Real> rhsnorm0 = MLRhsNormInf(local);
     if (!is_nsolve) {
-        ParallelAllReduce::Max<Real>({resnorm0, rhsnorm0}, ParallelContext::CommunicatorSub());
+        Vector<Real> norms0(resnorm0);
+        norms0.insert(norms0.end(), rhsnorm0.begin(), rhsnorm0.end());
+        ParallelAllReduce::Max(norms0.data(), norms0.size(), ParallelContext::CommunicatorSub());
+        std::copy(norms0.begin(), norms0.begin()+ncomp, resnorm0.begin());
+        std::copy(norms0.begin()+ncomp, norms0.end(), rhsnorm0.begin());
 
         if (verbose >= 1)
         {
-            amrex::Print() << "MLMG: Initial rhs               = " << rhsnorm0 << "\n"
-                           << "MLMG: Initial residual (resid0) = " << resnorm0 << "\n";
+            amrex::Print() << "MLMG: Initial rhs               = "
+                           << *std::max_element(rhsnorm0.begin(), rhsnorm0.end()) << "\n"
+                           << "MLMG: Initial residual (resid0) = "
+                           << *std::max_element(resnorm0.begin(), resnorm0.end()) << "\n";
         }
     }
 
-    Real max_norm;
-    std::string norm_name;
-    if (always_use_bnorm or rhsnorm0 >= resnorm0) {
-        norm_name = "bnorm";
-        max_norm = rhsnorm0;
-    } else {
-        norm_name = "resid0";
-        max_norm = resnorm0;
-    }
-    const Real res_target = std::max(a_tol_abs, std::max(a_tol_rel,1.e-16)*max_norm);
-
-    if (!is_nsolve && resnorm0 <= res_target) {
-        composite_norminf = resnorm0;
+    Vector<Real> max_norm(ncomp);
+    Vector<Real> res_target(ncomp);
+    bool use_bnorm = true;
+    for (int n = 0; n < ncomp; ++n) {
+        if (always_use_bnorm or rhsnorm0[n] >= resnorm0[n]) {
+            max_norm[n] = rhsnorm0[n];
+        } else {
+            max_norm[n] = resnorm0[n];
+            use_bnorm = false;
+        }
+        res_target[n] = std::max(a_tol_abs, std::max(a_tol_rel,1.e-16)*max_norm[n]);
+    }
+    const std::string norm_name = use_bnorm ? "bnorm" : "resid0";
+
+    // Largest norm and largest relative norm over all components.  A
+    // component with zero rhs and zero initial residual has nothing to
+    // be relative to; its residual stays zero and is reported as is.
+    auto max_abs = [&] (const Vector<Real>& norm) -> Real {
+        return *std::max_element(norm.begin(), norm.end());
+    };
+    auto rel = [&] (const Vector<Real>& norm, int n) -> Real {
+        return (max_norm[n] > 0.0) ? norm[n]/max_norm[n] : norm[n];
+    };
+    auto max_rel = [&] (const Vector<Real>& norm) -> Real {
+        Real r = 0.0;
+        for (int n = 0; n < ncomp; ++n) {
+            r = std::max(r, rel(norm,n));
+        }
+        return r;
+    };
+    auto is_converged = [&] (const Vector<Real>& norm) -> bool {
+        for (int n = 0; n < ncomp; ++n) {
+            if (norm[n] > res_target[n]) return false;
+        }
+        return true;
+    };
+
+    if (!is_nsolve && is_converged(resnorm0)) {
+        composite_norminf = max_abs(resnorm0);
         if (verbose >= 1) {
             amrex::Print() << "MLMG: No iterations needed\n";
         }
     } else {
         Real iter_start_time = amrex::second();
         bool converged = false;
+        res_history.clear();
+        Vector<Real> composite_norm(ncomp, 0.0);
 
         const int niters = do_fixed_number_of_iters ? do_fixed_number_of_iters : max_iters;
         for (int iter = 0; iter < niters; ++iter)
@@ -118,37 +216,48 @@ MLMG::solve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab const*>& a_rh
 
             if (is_nsolve) continue;
 
-            Real fine_norminf = ResNormInf(finest_amr_lev);
-            composite_norminf = fine_norminf;
+            const Vector<Real> fine_norminf = ResNormInf(finest_amr_lev);
+            composite_norm = fine_norminf;
+            res_history.push_back(max_rel(fine_norminf));
             if (verbose >= 2) {
                 amrex::Print() << "MLMG: Iteration " << std::setw(3) << iter+1 << " Fine resid/"
-                               << norm_name << " = " << fine_norminf/max_norm << "\n";
+                               << norm_name << " = " << max_rel(fine_norminf) << "\n";
+                if (ncomp > 1 && verbose >= 3) {
+                    for (int n = 0; n < ncomp; ++n) {
+                        amrex::Print() << "MLMG:                 component " << n << " Fine resid/"
+                                       << norm_name << " = " << rel(fine_norminf,n) << "\n";
+                    }
+                }
             }
-            bool fine_converged = (fine_norminf <= res_target);
+            bool fine_converged = is_converged(fine_norminf);
 
             if (namrlevs == 1 and fine_converged) {
                 converged = true;
             } else if (fine_converged) {
                 // finest level is converged, but we still need to test the coarse levels
                 computeMLResidual(finest_amr_lev-1);
-                Real crse_norminf = MLResNormInf(finest_amr_lev-1);
+                const Vector<Real> crse_norminf = MLResNormInf(finest_amr_lev-1);
                 if (verbose >= 2) {
                     amrex::Print() << "MLMG: Iteration " << std::setw(3) << iter+1
                                    << " Crse resid/" << norm_name << " = "
-                                   << crse_norminf/max_norm << "\n";
+                                   << max_rel(crse_norminf) << "\n";
+                }
+                converged = is_converged(crse_norminf);
+                for (int n = 0; n < ncomp; ++n) {
+                    composite_norm[n] = std::max(fine_norminf[n], crse_norminf[n]);
                 }
-                converged = (crse_norminf <= res_target);
-                composite_norminf = std::max(fine_norminf, crse_norminf);
             } else {
                 converged = false;
             }
 
+            composite_norminf = max_abs(composite_norm);
+
             if (converged) {
                 if (verbose >= 1) {
                     amrex::Print() << "MLMG: Final Iter. " << iter+1
                                    << " resid, resid/" << norm_name << " = "
                                    << composite_norminf << ", "
-                                   << composite_norminf/max_norm << "\n";
+                                   << max_rel(composite_norm) << "\n";
                 }
                 break;
             }
@@ -158,7 +267,7 @@ MLMG::solve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab const*>& a_rh
                 amrex::Print() << "MLMG: Failed to converge after " << max_iters << " iterations."
                                << " resid, resid/" << norm_name << " = "
                                << composite_norminf << ", "
-                               << composite_norminf/max_norm << "\n";
+                               << max_rel(composite_norm) << "\n";
             }
             amrex::Abort("MLMG failed");
         }
@@ -221,7 +330,17 @@ void MLMG::oneIter (int iter)
             makeSolvable(0,0,res[0][0]);
         }
 
-        if (iter < max_fmg_iters) {
+        if (use_single_precision)
+        {
+            convertCopy(res_sp[0], res[0][0], ncomp);
+            if (iter < max_fmg_iters) {
+                mgFcycleSingle ();
+            } else {
+                mgVcycleSingle (0);
+            }
+            convertCopy(*cor[0][0], cor_sp[0], ncomp);
+        }
+        else if (iter < max_fmg_iters) {
             mgFcycle ();
         } else {
             mgVcycle (0, 0);
@@ -876,14 +995,14 @@ MLMG::actualBottomSolve ()
     timer[bottom_time] += amrex::second() - bottom_start_time;
 }
 
-// Compute single-level masked inf-norm of Residual (res).
-Real
+// Compute single-level masked inf-norm of Residual (res), one value per component.
+Vector<Real>
 MLMG::ResNormInf (int alev, bool local)
 {
     BL_PROFILE("MLMG::ResNormInf()");
     const int ncomp = linop.getNComp();
     const int mglev = 0;
-    Real norm = 0.0;
+    Vector<Real> norm(ncomp, 0.0);
     MultiFab* pmf = &(res[alev][mglev]);
 #ifdef AMREX_USE_EB
     if (linop.isCellCentered() && scratch[alev]) {
@@ -898,39 +1017,41 @@ MLMG::ResNormInf (int alev, bool local)
 #endif
     for (int n = 0; n < ncomp; n++)
     {
-	Real newnorm = 0.0;
 	if (fine_mask[alev]) {
-            newnorm = pmf->norm0(*fine_mask[alev],n,0,true);
+            norm[n] = pmf->norm0(*fine_mask[alev],n,0,true);
 	} else {
-            newnorm = pmf->norm0(n,0,true);
+            norm[n] = pmf->norm0(n,0,true);
 	}
-	if (newnorm > norm) norm = newnorm;
     }
-    if (!local) ParallelAllReduce::Max(norm, ParallelContext::CommunicatorSub());
+    if (!local) ParallelAllReduce::Max(norm.data(), ncomp, ParallelContext::CommunicatorSub());
     return norm;
 }
 
-// Computes multi-level masked inf-norm of Residual (res).
-Real
+// Computes multi-level masked inf-norm of Residual (res), one value per component.
+Vector<Real>
 MLMG::MLResNormInf (int alevmax, bool local)
 {
     BL_PROFILE("MLMG::MLResNormInf()");
-    Real r = 0.0;
+    const int ncomp = linop.getNComp();
+    Vector<Real> r(ncomp, 0.0);
     for (int alev = 0; alev <= alevmax; ++alev)
     {
-        r = std::max(r, ResNormInf(alev,true));
+        const Vector<Real>& rlev = ResNormInf(alev,true);
+        for (int n = 0; n < ncomp; ++n) {
+            r[n] = std::max(r[n], rlev[n]);
+        }
     }
-    if (!local) ParallelAllReduce::Max(r, ParallelContext::CommunicatorSub());
+    if (!local) ParallelAllReduce::Max(r.data(), ncomp, ParallelContext::CommunicatorSub());
     return r;
 }
 
-// Compute multi-level masked inf-norm of RHS (rhs).
-Real
+// Compute multi-level masked inf-norm of RHS (rhs), one value per component.
+Vector<Real>
 MLMG::MLRhsNormInf (bool local)
 {
     BL_PROFILE("MLMG::MLRhsNormInf()");
     const int ncomp = linop.getNComp();
-    Real r = 0.0;
+    Vector<Real> r(ncomp, 0.0);
     for (int alev = 0; alev <= finest_amr_lev; ++alev)
     {
         MultiFab* pmf = &(rhs[alev]);
@@ -948,13 +1069,13 @@ MLMG::MLRhsNormInf (bool local)
         for (int n=0; n<ncomp; ++n)
         {
             if (alev < finest_amr_lev) {
-                r = std::max(r, pmf->norm0(*fine_mask[alev],n,0,true));
+                r[n] = std::max(r[n], pmf->norm0(*fine_mask[alev],n,0,true));
             } else {
-                r = std::max(r, pmf->norm0(n,0,true));
+                r[n] = std::max(r[n], pmf->norm0(n,0,true));
             }
         }
     }
-    if (!local) ParallelAllReduce::Max(r, ParallelContext::CommunicatorSub());
+    if (!local) ParallelAllReduce::Max(r.data(), ncomp, ParallelContext::CommunicatorSub());
     return r;
 }
 
@@ -1021,6 +1142,20 @@ MLMG::prepareForSolve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab con
         linop.update();
     }
 
+    linop.prepareSmoother();
+
+    if (!solve_called)
+    {
+        use_single_precision = do_single_precision_cycle
+            && linop.supportsSinglePrecisionCycle() && linop.NMGLevels(0) > 1;
+        if (do_single_precision_cycle && !use_single_precision && verbose >= 1) {
+            amrex::Print() << "MLMG: single precision cycles not supported by this operator\n";
+        }
+    }
+    if (use_single_precision) {
+        linop.prepareSinglePrecisionCycle();
+    }
+
 #ifdef AMREX_USE_HYPRE
     hypre_solver.reset();
     hypre_bndry.reset();
@@ -1094,8 +1229,12 @@ MLMG::prepareForSolve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab con
         const int nmglevs = linop.NMGLevels(alev);
         for (int mglev = 0; mglev < nmglevs; ++mglev)
         {
-               res[alev][mglev].setVal(0.0);
-            rescor[alev][mglev].setVal(0.0);
+            if (!res[alev][mglev].empty()) {
+                res[alev][mglev].setVal(0.0);
+            }
+            if (!rescor[alev][mglev].empty()) {
+                rescor[alev][mglev].setVal(0.0);
+            }
         }
     }
 
@@ -1113,7 +1252,9 @@ MLMG::prepareForSolve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab con
                                                     ncomp, ng, MFInfo(),
                                                     *linop.Factory(alev,mglev)));
             }
-            cor[alev][mglev]->setVal(0.0);
+            if (cor[alev][mglev]) {
+                cor[alev][mglev]->setVal(0.0);
+            }
         }
     }
 
@@ -1124,13 +1265,15 @@ MLMG::prepareForSolve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab con
         cor_hold[alev].resize(nmglevs);
         for (int mglev = 0; mglev < nmglevs-1; ++mglev)
         {
-            if (!solve_called) {
+            if (!solve_called && !use_single_precision) {
                 cor_hold[alev][mglev].reset(new MultiFab(cor[alev][mglev]->boxArray(),
                                                          cor[alev][mglev]->DistributionMap(),
                                                          ncomp, ng, MFInfo(),
                                                          *linop.Factory(alev,mglev)));
             }
-            cor_hold[alev][mglev]->setVal(0.0);
+            if (cor_hold[alev][mglev]) {
+                cor_hold[alev][mglev]->setVal(0.0);
+            }
         }
     }
     for (int alev = 1; alev < finest_amr_lev; ++alev)
@@ -1145,6 +1288,39 @@ MLMG::prepareForSolve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab con
         cor_hold[alev][0]->setVal(0.0);
     }
 
+    if (use_single_precision)
+    {
+        // The single precision hierarchy replaces res, cor, cor_hold and
+        // rescor on the coarsest AMR level.  Only res and cor on the top
+        // MG level (for the outer iteration) and on the bottom MG level
+        // (for the bottom solver) are kept in double precision.
+        const int nmglevs = linop.NMGLevels(0);
+        if (!solve_called)
+        {
+            res_sp.resize(nmglevs);
+            cor_sp.resize(nmglevs);
+            rescor_sp.resize(nmglevs);
+            cor_hold_sp.resize(nmglevs-1);
+            for (int mglev = 0; mglev < nmglevs; ++mglev)
+            {
+                const BoxArray& ba = linop.m_grids[0][mglev];
+                const DistributionMapping& dm = linop.m_dmap[0][mglev];
+                res_sp[mglev].define(ba, dm, ncomp, 0);
+                cor_sp[mglev].define(ba, dm, ncomp, 1);
+                rescor_sp[mglev].define(ba, dm, ncomp, 0);
+
+                rescor[0][mglev].clear();
+                if (mglev > 0 && mglev < nmglevs-1) {
+                    res[0][mglev].clear();
+                    cor[0][mglev].reset();
+                }
+            }
+        }
+        for (int mglev = 0; mglev < nmglevs; ++mglev) {
+            cor_sp[mglev].setVal(0.0f);
+        }
+    }
+
     buildFineMask();
 
     if (!solve_called)
@@ -1685,4 +1861,703 @@ MLMG::bottomSolveWithPETSc (MultiFab& x, const MultiFab& b)
 #endif
 }
     
+
+// V-cycle on the coarsest AMR level with the single precision hierarchy.
+// in : Residual (res_sp) on the top MG level
+// out: Correction (cor_sp) on all MG levels
+void
+MLMG::mgVcycleSingle (int mglev_top)
+{
+    BL_PROFILE("MLMG::mgVcycleSingle()");
+
+    const int amrlev = 0;
+    const int mglev_bottom = linop.NMGLevels(amrlev) - 1;
+
+    for (int mglev = mglev_top; mglev < mglev_bottom; ++mglev)
+    {
+        cor_sp[mglev].setVal(0.0f);
+        bool skip_fillboundary = true;
+        for (int i = 0; i < nu1; ++i) {
+            linop.smoothSingle(amrlev, mglev, cor_sp[mglev], res_sp[mglev], skip_fillboundary);
+            skip_fillboundary = false;
+        }
+
+        // rescor = res - L(cor)
+        linop.correctionResidualSingle(amrlev, mglev, rescor_sp[mglev], cor_sp[mglev], res_sp[mglev]);
+
+        // res_crse = R(rescor_fine); this provides res/b to the level below
+        linop.restrictionSingle(amrlev, mglev+1, res_sp[mglev+1], rescor_sp[mglev]);
+    }
+
+    bottomSolveSingle();
+
+    for (int mglev = mglev_bottom-1; mglev >= mglev_top; --mglev)
+    {
+        // cor_fine += I(cor_crse)
+        addInterpCorrectionSingle(mglev);
+        for (int i = 0; i < nu2; ++i) {
+            linop.smoothSingle(amrlev, mglev, cor_sp[mglev], res_sp[mglev]);
+        }
+    }
+}
+
+// F-cycle with the single precision hierarchy.  Unlike mgFcycle, the
+// correction is prolongated with piecewise constant interpolation.
+void
+MLMG::mgFcycleSingle ()
+{
+    BL_PROFILE("MLMG::mgFcycleSingle()");
+
+    const int amrlev = 0;
+    const int mg_bottom_lev = linop.NMGLevels(amrlev) - 1;
+    const int ncomp = linop.getNComp();
+
+    if (cor_hold_sp[0].empty())
+    {
+        for (int mglev = 0; mglev < mg_bottom_lev; ++mglev) {
+            cor_hold_sp[mglev].define(cor_sp[mglev].boxArray(), cor_sp[mglev].DistributionMap(),
+                                      ncomp, 1);
+        }
+    }
+
+    for (int mglev = 1; mglev <= mg_bottom_lev; ++mglev)
+    {
+        linop.restrictionSingle(amrlev, mglev, res_sp[mglev], res_sp[mglev-1]);
+    }
+
+    bottomSolveSingle();
+
+    for (int mglev = mg_bottom_lev-1; mglev >= 0; --mglev)
+    {
+        // cor_fine = I(cor_crse)
+        cor_sp[mglev].setVal(0.0f);
+        addInterpCorrectionSingle(mglev);
+
+        // rescor = res - L(cor)
+        linop.correctionResidualSingle(amrlev, mglev, rescor_sp[mglev], cor_sp[mglev], res_sp[mglev]);
+        // res = rescor; this provides b to the vcycle below
+        std::swap(res_sp[mglev], rescor_sp[mglev]);
+
+        // save cor; do v-cycle; add the saved to cor
+        std::swap(cor_sp[mglev], cor_hold_sp[mglev]);
+        mgVcycleSingle(mglev);
+        addSingle(cor_sp[mglev], cor_hold_sp[mglev], ncomp);
+    }
+}
+
+// (Fine MG level correction) += I(Coarse MG level correction) in single precision
+void
+MLMG::addInterpCorrectionSingle (int mglev)
+{
+    BL_PROFILE("MLMG::addInterpCorrectionSingle()");
+
+    const int ncomp = linop.getNComp();
+
+    const MLLinOp::FloatMultiFab& crse_cor = cor_sp[mglev+1];
+    MLLinOp::FloatMultiFab&       fine_cor = cor_sp[mglev  ];
+
+    const int refratio = 2;
+    MLLinOp::FloatMultiFab cfine;
+    const MLLinOp::FloatMultiFab* cmf;
+
+    if (amrex::isMFIterSafe(crse_cor, fine_cor))
+    {
+        cmf = &crse_cor;
+    }
+    else
+    {
+        BoxArray cba = fine_cor.boxArray();
+        cba.coarsen(refratio);
+        cfine.define(cba, fine_cor.DistributionMap(), ncomp, 0);
+        cfine.ParallelCopy(crse_cor);
+        cmf = &cfine;
+    }
+
+    linop.interpolationSingle(0, mglev, fine_cor, *cmf);
+}
+
+// The bottom solvers work in double precision on res and cor of the
+// bottom MG level.
+void
+MLMG::bottomSolveSingle ()
+{
+    const int ncomp = linop.getNComp();
+    const int mglev = linop.NMGLevels(0) - 1;
+    convertCopy(res[0][mglev], res_sp[mglev], ncomp);
+    bottomSolve();
+    convertCopy(cor_sp[mglev], *cor[0][mglev], ncomp);
+}
+
+
+// Krylov outer solver preconditioned by one MLMG cycle.  The Krylov
+// vectors live on all AMR levels in the frame of the original equation.
+// The coarse cells covered by fine levels are masked out of the inner
+// products.  The composite operator is MLMG::apply.  It includes the
+// inhomogeneous boundary conditions, so g = L(0) is subtracted to make
+// it linear.
+Real
+MLMG::solveKrylov (const Vector<MultiFab*>& a_sol, const Vector<MultiFab const*>& a_rhs,
+                   Real a_tol_rel, Real a_tol_abs)
+{
+    BL_PROFILE("MLMG::solveKrylov()");
+
+    AMREX_ALWAYS_ASSERT_WITH_MESSAGE(linop.isCellCentered(),
+                                     "MLMG: Krylov outer solver requires a cell-centered operator");
+
+    Real solve_start_time = amrex::second();
+
+    const int ncomp = linop.getNComp();
+
+    prepareForSolve(a_sol, a_rhs);
+
+    // sol is used by the preconditioner, so the solution is kept in x.
+    Vector<MultiFab> x, b, g, r;
+    krylovMake(x);
+    krylovMake(b);
+    krylovMake(g);
+    krylovMake(r);
+    for (int alev = 0; alev < namrlevs; ++alev)
+    {
+        MultiFab::Copy(x[alev], *sol[alev], 0, 0, ncomp, 0);
+        MultiFab::Copy(b[alev], rhs[alev], 0, 0, ncomp, 0);
+#if (AMREX_SPACEDIM != 3)
+        linop.unapplyMetricTerm(alev, 0, b[alev]);
+#endif
+    }
+
+    {
+        Vector<MultiFab> zero;
+        krylovMake(zero);
+        apply(amrex::GetVecOfPtrs(g), amrex::GetVecOfPtrs(zero));
+    }
+
+    krylovResidual(r, x, b);
+
+    const Vector<Real> resnorm0 = krylovNormInf(r);
+    const Vector<Real> rhsnorm0 = krylovNormInf(b);
+    if (verbose >= 1)
+    {
+        amrex::Print() << "MLMG: Initial rhs               = "
+                       << *std::max_element(rhsnorm0.begin(), rhsnorm0.end()) << "\n"
+                       << "MLMG: Initial residual (resid0) = "
+                       << *std::max_element(resnorm0.begin(), resnorm0.end()) << "\n";
+    }
+
+    Vector<Real> max_norm(ncomp);
+    Vector<Real> res_target(ncomp);
+    bool use_bnorm = true;
+    for (int n = 0; n < ncomp; ++n) {
+        if (always_use_bnorm or rhsnorm0[n] >= resnorm0[n]) {
+            max_norm[n] = rhsnorm0[n];
+        } else {
+            max_norm[n] = resnorm0[n];
+            use_bnorm = false;
+        }
+        res_target[n] = std::max(a_tol_abs, std::max(a_tol_rel,1.e-16)*max_norm[n]);
+    }
+    const std::string norm_name = use_bnorm ? "bnorm" : "resid0";
+
+    Vector<Real> composite_norm = resnorm0;
+
+    const KrylovCheck check = [&] (const Vector<MultiFab>& res_vec, Real& reduction, Real& relnorm) -> bool
+    {
+        composite_norm = krylovNormInf(res_vec);
+        bool converged = true;
+        relnorm = 0.0;
+        reduction = 1.0;
+        for (int n = 0; n < ncomp; ++n) {
+            converged = converged && composite_norm[n] <= res_target[n];
+            relnorm = std::max(relnorm, (max_norm[n] > 0.0) ? composite_norm[n]/max_norm[n]
+                                                            : composite_norm[n]);
+            if (composite_norm[n] > 0.0) {
+                reduction = std::min(reduction, res_target[n]/composite_norm[n]);
+            }
+        }
+        return converged;
+    };
+
+    res_history.clear();
+
+    Real reduction, relnorm;
+    bool converged = check(r, reduction, relnorm);
+    if (converged)
+    {
+        if (verbose >= 1) {
+            amrex::Print() << "MLMG: No iterations needed\n";
+        }
+    }
+    else
+    {
+        Real iter_start_time = amrex::second();
+
+        if (krylov_solver == KrylovSolver::cg) {
+            converged = krylovCG(x, b, g, r, check);
+        } else if (krylov_solver == KrylovSolver::bicgstab) {
+            converged = krylovBiCGStab(x, b, g, r, check);
+        } else {
+            converged = krylovFGMRES(x, b, g, r, check);
+        }
+        check(r, reduction, relnorm);
+
+        const Real composite_norminf = *std::max_element(composite_norm.begin(), composite_norm.end());
+        if (converged) {
+            if (verbose >= 1) {
+                amrex::Print() << "MLMG: Final Iter. " << getNumIters()
+                               << " resid, resid/" << norm_name << " = "
+                               << composite_norminf << ", " << relnorm << "\n";
+            }
+        } else if (do_fixed_number_of_iters == 0) {
+            if (verbose > 0) {
+                amrex::Print() << "MLMG: Failed to converge after " << getNumIters() << " iterations."
+                               << " resid, resid/" << norm_name << " = "
+                               << composite_norminf << ", " << relnorm << "\n";
+            }
+            amrex::Abort("MLMG failed");
+        }
+        timer[iter_time] = amrex::second() - iter_start_time;
+    }
+
+    // The ghost cells of x have been filled by the last residual computation.
+    int ng_back = final_fill_bc ? 1 : 0;
+    for (int alev = 0; alev < namrlevs; ++alev)
+    {
+        MultiFab::Copy(*a_sol[alev], x[alev], 0, 0, ncomp, ng_back);
+    }
+
+    timer[solve_time] = amrex::second() - solve_start_time;
+    if (verbose >= 1) {
+        ParallelReduce::Max<Real>(timer.data(), timer.size(), 0,
+                                  ParallelContext::CommunicatorSub());
+        if (ParallelContext::MyProcSub() == 0)
+        {
+            amrex::AllPrint() << "MLMG: Timers: Solve = " << timer[solve_time]
+                              << " Iter = " << timer[iter_time]
+                              << " Bottom = " << timer[bottom_time] << "\n";
+        }
+    }
+
+    ++solve_called;
+
+    return *std::max_element(composite_norm.begin(), composite_norm.end());
+}
+
+// Preconditioned CG.  The Polak-Ribiere formula for beta makes it
+// tolerant of the slight nonlinearity of the multigrid preconditioner.
+bool
+MLMG::krylovCG (Vector<MultiFab>& x, const Vector<MultiFab>& b, const Vector<MultiFab>& g,
+                Vector<MultiFab>& r, const KrylovCheck& check)
+{
+    BL_PROFILE("MLMG::krylovCG()");
+
+    const int ncomp = linop.getNComp();
+    const int niters = do_fixed_number_of_iters ? do_fixed_number_of_iters : max_iters;
+
+    Vector<MultiFab> z, p, q, rold;
+    krylovMake(z);
+    krylovMake(p);
+    krylovMake(q);
+    krylovMake(rold);
+
+    Real rho = 0.0;
+    bool restart = true;
+    for (int iter = 0; iter < niters; ++iter)
+    {
+        krylovPrecond(z, r, g);
+
+        Real rz[2] = { krylovDot(r, z, true), 0.0 };
+        if (!restart) rz[1] = krylovDot(rold, z, true);
+        ParallelAllReduce::Sum(rz, 2, ParallelContext::CommunicatorSub());
+
+        if (restart) {
+            for (int alev = 0; alev < namrlevs; ++alev) {
+                MultiFab::Copy(p[alev], z[alev], 0, 0, ncomp, 0);
+            }
+        } else {
+            const Real beta = (rz[0] - rz[1]) / rho;
+            for (int alev = 0; alev < namrlevs; ++alev) {
+                MultiFab::Xpay(p[alev], beta, z[alev], 0, 0, ncomp, 0);
+            }
+        }
+        rho = rz[0];
+        restart = false;
+
+        krylovApply(q, p, g);
+        const Real pq = krylovDot(p, q);
+        if (rho == 0.0 || pq == 0.0) break;
+        const Real alpha = rho / pq;
+
+        for (int alev = 0; alev < namrlevs; ++alev) {
+            MultiFab::Copy(rold[alev], r[alev], 0, 0, ncomp, 0);
+            MultiFab::Saxpy(x[alev],  alpha, p[alev], 0, 0, ncomp, 0);
+            MultiFab::Saxpy(r[alev], -alpha, q[alev], 0, 0, ncomp, 0);
+        }
+
+        Real reduction, relnorm;
+        const bool converged = check(r, reduction, relnorm);
+        res_history.push_back(relnorm);
+        if (verbose >= 2) {
+            amrex::Print() << "MLMG: CG Iteration " << std::setw(3) << iter+1
+                           << " resid/norm = " << relnorm << "\n";
+        }
+        if (converged) {
+            // The recursively updated residual drifts from the true one
+            // when the coefficients vary by orders of magnitude.  If the
+            // true residual is not converged yet, restart from it.
+            krylovResidual(r, x, b);
+            const bool true_converged = check(r, reduction, relnorm);
+            res_history.back() = relnorm;
+            if (true_converged) return true;
+            restart = true;
+        }
+    }
+
+    // Replace the recursively updated residual with the true one.
+    krylovResidual(r, x, b);
+    Real reduction, relnorm;
+    return check(r, reduction, relnorm);
+}
+
+// Right-preconditioned BiCGStab.
+bool
+MLMG::krylovBiCGStab (Vector<MultiFab>& x, const Vector<MultiFab>& b, const Vector<MultiFab>& g,
+                      Vector<MultiFab>& r, const KrylovCheck& check)
+{
+    BL_PROFILE("MLMG::krylovBiCGStab()");
+
+    const int ncomp = linop.getNComp();
+    const int niters = do_fixed_number_of_iters ? do_fixed_number_of_iters : max_iters;
+
+    Vector<MultiFab> rh, p, ph, v, s, sh, t;
+    krylovMake(rh);
+    krylovMake(p);
+    krylovMake(ph);
+    krylovMake(v);
+    krylovMake(s);
+    krylovMake(sh);
+    krylovMake(t);
+
+    Real rho_1 = 0.0, alpha = 0.0, omega = 0.0;
+    bool restart = true;
+    for (int iter = 0; iter < niters; ++iter)
+    {
+        if (restart) {
+            for (int alev = 0; alev < namrlevs; ++alev) {
+                MultiFab::Copy(rh[alev], r[alev], 0, 0, ncomp, 0);
+            }
+        }
+
+        const Real rho = krylovDot(rh, r);
+        if (rho == 0.0) break;
+
+        if (restart) {
+            for (int alev = 0; alev < namrlevs; ++alev) {
+                MultiFab::Copy(p[alev], r[alev], 0, 0, ncomp, 0);
+            }
+        } else {
+            const Real beta = (rho/rho_1)*(alpha/omega);
+            for (int alev = 0; alev < namrlevs; ++alev) {
+                MultiFab::Saxpy(p[alev], -omega, v[alev], 0, 0, ncomp, 0); // p = p - omega*v
+                MultiFab::Xpay(p[alev], beta, r[alev], 0, 0, ncomp, 0);    // p = r + beta*p
+            }
+        }
+        restart = false;
+
+        krylovPrecond(ph, p, g);
+        krylovApply(v, ph, g);
+
+        const Real rhv = krylovDot(rh, v);
+        if (rhv == 0.0) break;
+        alpha = rho/rhv;
+
+        for (int alev = 0; alev < namrlevs; ++alev) {
+            MultiFab::Saxpy(x[alev], alpha, ph[alev], 0, 0, ncomp, 0);
+            MultiFab::LinComb(s[alev], 1.0, r[alev], 0, -alpha, v[alev], 0, 0, ncomp, 0);
+        }
+
+        // As in CG, convergence of the recursively updated residual is
+        // confirmed with the true residual.
+        Real reduction, relnorm;
+        if (check(s, reduction, relnorm)) {
+            res_history.push_back(relnorm);
+            krylovResidual(r, x, b);
+            const bool true_converged = check(r, reduction, relnorm);
+            res_history.back() = relnorm;
+            if (true_converged) return true;
+            restart = true;
+            continue;
+        }
+
+        krylovPrecond(sh, s, g);
+        krylovApply(t, sh, g);
+
+        Real tvals[2] = { krylovDot(t, s, true), krylovDot(t, t, true) };
+        ParallelAllReduce::Sum(tvals, 2, ParallelContext::CommunicatorSub());
+        if (tvals[1] == 0.0) break;
+        omega = tvals[0]/tvals[1];
+
+        for (int alev = 0; alev < namrlevs; ++alev) {
+            MultiFab::Saxpy(x[alev], omega, sh[alev], 0, 0, ncomp, 0);
+            MultiFab::LinComb(r[alev], 1.0, s[alev], 0, -omega, t[alev], 0, 0, ncomp, 0);
+        }
+
+        const bool converged = check(r, reduction, relnorm);
+        res_history.push_back(relnorm);
+        if (verbose >= 2) {
+            amrex::Print() << "MLMG: BiCGStab Iteration " << std::setw(3) << iter+1
+                           << " resid/norm = " << relnorm << "\n";
+        }
+        if (converged) {
+            krylovResidual(r, x, b);
+            const bool true_converged = check(r, reduction, relnorm);
+            res_history.back() = relnorm;
+            if (true_converged) return true;
+            restart = true;
+        } else if (omega == 0.0) {
+            break;
+        }
+
+        rho_1 = rho;
+    }
+
+    krylovResidual(r, x, b);
+    Real reduction, relnorm;
+    return check(r, reduction, relnorm);
+}
+
+// Flexible GMRES(m) with classical Gram-Schmidt applied twice, so that
+// each orthogonalization pass needs a single reduction.
+bool
+MLMG::krylovFGMRES (Vector<MultiFab>& x, const Vector<MultiFab>& b, const Vector<MultiFab>& g,
+                    Vector<MultiFab>& r, const KrylovCheck& check)
+{
+    BL_PROFILE("MLMG::krylovFGMRES()");
+
+    const int ncomp = linop.getNComp();
+    const int niters = do_fixed_number_of_iters ? do_fixed_number_of_iters : max_iters;
+    const int m = std::max(krylov_restart, 1);
+
+    Vector<Vector<MultiFab> > V(m+1), Z(m);
+    for (auto& v : V) krylovMake(v);
+    for (auto& z : Z) krylovMake(z);
+
+    // Hessenberg matrix stored by column, Givens rotations and the
+    // right-hand side of the least-squares problem.
+    Vector<Vector<Real> > H(m, Vector<Real>(m+1));
+    Vector<Real> cs(m), sn(m), gam(m+1), y(m), h(m+1);
+
+    Real reduction, relnorm;
+    check(r, reduction, relnorm);
+
+    int iter = 0;
+    while (iter < niters)
+    {
+        const Real beta = std::sqrt(krylovDot(r, r));
+        if (beta == 0.0) return true;
+
+        for (int alev = 0; alev < namrlevs; ++alev) {
+            MultiFab::LinComb(V[0][alev], 1.0/beta, r[alev], 0, 0.0, r[alev], 0, 0, ncomp, 0);
+        }
+        std::fill(gam.begin(), gam.end(), 0.0);
+        gam[0] = beta;
+
+        const Real relnorm0 = relnorm;
+        int k = 0;
+        for (; k < m && iter < niters; ++k, ++iter)
+        {
+            krylovPrecond(Z[k], V[k], g);
+            krylovApply(V[k+1], Z[k], g);
+
+            std::fill(H[k].begin(), H[k].end(), 0.0);
+            for (int pass = 0; pass < 2; ++pass)
+            {
+                for (int i = 0; i <= k; ++i) {
+                    h[i] = krylovDot(V[i], V[k+1], true);
+                }
+                ParallelAllReduce::Sum(h.data(), k+1, ParallelContext::CommunicatorSub());
+                for (int i = 0; i <= k; ++i) {
+                    H[k][i] += h[i];
+                    for (int alev = 0; alev < namrlevs; ++alev) {
+                        MultiFab::Saxpy(V[k+1][alev], -h[i], V[i][alev], 0, 0, ncomp, 0);
+                    }
+                }
+            }
+
+            // A zero norm means the Krylov space contains the solution.
+            const Real hnorm = std::sqrt(krylovDot(V[k+1], V[k+1]));
+            H[k][k+1] = hnorm;
+            if (hnorm > 0.0) {
+                for (int alev = 0; alev < namrlevs; ++alev) {
+                    V[k+1][alev].mult(1.0/hnorm, 0, ncomp, 0);
+                }
+            }
+
+            for (int i = 0; i < k; ++i) {
+                const Real tmp = cs[i]*H[k][i] + sn[i]*H[k][i+1];
+                H[k][i+1] = -sn[i]*H[k][i] + cs[i]*H[k][i+1];
+                H[k][i] = tmp;
+            }
+            const Real denom = std::sqrt(H[k][k]*H[k][k] + H[k][k+1]*H[k][k+1]);
+            if (denom == 0.0) break;
+            cs[k] = H[k][k]/denom;
+            sn[k] = H[k][k+1]/denom;
+            H[k][k] = denom;
+            H[k][k+1] = 0.0;
+            gam[k+1] = -sn[k]*gam[k];
+            gam[k] *= cs[k];
+
+            // The residual of the least-squares problem estimates the
+            // decrease of the residual within this cycle.
+            const Real est = std::abs(gam[k+1])/beta;
+            res_history.push_back(relnorm0*est);
+            if (verbose >= 2) {
+                amrex::Print() << "MLMG: FGMRES Iteration " << std::setw(3) << iter+1
+                               << " estimated resid/norm = " << relnorm0*est << "\n";
+            }
+            if (est <= reduction || hnorm == 0.0) {
+                ++k;
+                ++iter;
+                break;
+            }
+        }
+
+        for (int i = k-1; i >= 0; --i) {
+            y[i] = gam[i];
+            for (int j = i+1; j < k; ++j) {
+                y[i] -= H[j][i]*y[j];
+            }
+            y[i] /= H[i][i];
+        }
+        for (int i = 0; i < k; ++i) {
+            for (int alev = 0; alev < namrlevs; ++alev) {
+                MultiFab::Saxpy(x[alev], y[i], Z[i][alev], 0, 0, ncomp, 0);
+            }
+        }
+
+        krylovResidual(r, x, b);
+        const bool converged = check(r, reduction, relnorm);
+        if (!res_history.empty()) res_history.back() = relnorm;
+        if (converged) return true;
+        if (k == 0) break;
+    }
+
+    return false;
+}
+
+void
+MLMG::krylovMake (Vector<MultiFab>& v) const
+{
+    const int ncomp = linop.getNComp();
+    v.resize(namrlevs);
+    for (int alev = 0; alev < namrlevs; ++alev)
+    {
+        v[alev].define(rhs[alev].boxArray(), rhs[alev].DistributionMap(), ncomp, 1,
+                       MFInfo(), *linop.Factory(alev));
+        v[alev].setVal(0.0);
+    }
+}
+
+// Ax = L(x) - L(0)
+void
+MLMG::krylovApply (Vector<MultiFab>& Ax, Vector<MultiFab>& x, const Vector<MultiFab>& g)
+{
+    const int ncomp = linop.getNComp();
+    apply(amrex::GetVecOfPtrs(Ax), amrex::GetVecOfPtrs(x));
+    for (int alev = 0; alev < namrlevs; ++alev) {
+        MultiFab::Subtract(Ax[alev], g[alev], 0, 0, ncomp, 0);
+    }
+}
+
+// r = b - L(x)
+void
+MLMG::krylovResidual (Vector<MultiFab>& r, Vector<MultiFab>& x, const Vector<MultiFab>& b)
+{
+    const int ncomp = linop.getNComp();
+    apply(amrex::GetVecOfPtrs(r), amrex::GetVecOfPtrs(x));
+    for (int alev = 0; alev < namrlevs; ++alev) {
+        MultiFab::Xpay(r[alev], -1.0, b[alev], 0, 0, ncomp, 0);
+    }
+}
+
+// One MLMG cycle starting from zero for L(z) = r + L(0), i.e. for the
+// homogeneous problem with right-hand side r.
+void
+MLMG::krylovPrecond (Vector<MultiFab>& z, const Vector<MultiFab>& r, const Vector<MultiFab>& g)
+{
+    BL_PROFILE("MLMG::krylovPrecond()");
+
+    const int ncomp = linop.getNComp();
+
+    for (int alev = 0; alev < namrlevs; ++alev)
+    {
+        MultiFab::LinComb(rhs[alev], 1.0, r[alev], 0, 1.0, g[alev], 0, 0, ncomp, 0);
+        linop.applyMetricTerm(alev, 0, rhs[alev]);
+        sol[alev]->setVal(0.0);
+    }
+
+    for (int falev = finest_amr_lev; falev > 0; --falev)
+    {
+        linop.averageDownSolutionRHS(falev-1, *sol[falev-1], rhs[falev-1], *sol[falev], rhs[falev]);
+    }
+
+    if (linop.isSingular(0))
+    {
+        makeSolvable();
+    }
+
+    computeMLResidual(finest_amr_lev);
+    oneIter(0);
+
+    for (int alev = 0; alev < namrlevs; ++alev)
+    {
+        MultiFab::Copy(z[alev], *sol[alev], 0, 0, ncomp, 0);
+    }
+}
+
+// Composite inner product.  Coarse cells covered by fine levels are
+// excluded and each level is weighted by its cell volume relative to the
+// coarsest level.  The conservative composite operator is close to
+// symmetric in this inner product, which CG relies on.
+Real
+MLMG::krylovDot (const Vector<MultiFab>& x, const Vector<MultiFab>& y, bool local) const
+{
+    BL_PROFILE("MLMG::krylovDot()");
+
+    const int ncomp = linop.getNComp();
+    const auto& amrrr = linop.AMRRefRatio();
+    Real result = 0.0;
+    Real vol = 1.0;
+    for (int alev = 0; alev < namrlevs; ++alev)
+    {
+        if (alev > 0) vol /= AMREX_D_TERM(amrrr[alev-1],*amrrr[alev-1],*amrrr[alev-1]);
+        if (alev < finest_amr_lev) {
+            result += vol * MultiFab::Dot(*fine_mask[alev], x[alev], 0, y[alev], 0, ncomp, 0, true);
+        } else {
+            result += vol * MultiFab::Dot(x[alev], 0, y[alev], 0, ncomp, 0, true);
+        }
+    }
+    if (!local) ParallelAllReduce::Sum(result, ParallelContext::CommunicatorSub());
+    return result;
+}
+
+// Composite inf-norm, one value per component.
+Vector<Real>
+MLMG::krylovNormInf (const Vector<MultiFab>& r) const
+{
+    const int ncomp = linop.getNComp();
+    Vector<Real> norm(ncomp, 0.0);
+    for (int alev = 0; alev < namrlevs; ++alev)
+    {
+        for (int n = 0; n < ncomp; ++n)
+        {
+            if (alev < finest_amr_lev) {
+                norm[n] = std::max(norm[n], r[alev].norm0(*fine_mask[alev],n,0,true));
+            } else {
+                norm[n] = std::max(norm[n], r[alev].norm0(n,0,true));
+            }
+        }
+    }
+    ParallelAllReduce::Max(norm.data(), ncomp, ParallelContext::CommunicatorSub());
+    return norm;
+}
+
 }
@@ -6,6 +6,7 @@
 
 #ifdef AMREX_USE_EB
 #include <AMReX_EBMultiFabUtil.H>
+#include <AMReX_SparseCutFab.H>
 #endif
 
 #ifdef AMREX_USE_EB
@@ -2229,11 +2230,14 @@ MLNodeLaplacian::buildIntegral ()
             const int ncomp = intg->nComp();
             const auto& flags = factory->getMultiEBCellFlagFab();
             const auto& vfrac = factory->getVolFrac();
-            const auto& area = factory->getAreaFrac();
-            const auto& bcent = factory->getBndryCent();
+            const auto& area = factory->getSparseAreaFrac();
+            const auto& bcent = factory->getSparseBndryCent();
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
+            {
+            Array<FArrayBox,AMREX_SPACEDIM> areafab;
+            FArrayBox bcentfab;
             for (MFIter mfi(*intg, MFItInfo().EnableTiling().SetDynamic(true)); mfi.isValid(); ++mfi)
             {
                 const Box& bx = mfi.growntilebox();
@@ -2247,16 +2251,21 @@ MLNodeLaplacian::buildIntegral ()
                     amrex_mlndlap_set_integral(BL_TO_FORTRAN_BOX(bx),
                                                BL_TO_FORTRAN_ANYD(gfab));
                 } else {
+                    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                        (*area[idim])[mfi].toFab(areafab[idim], amrex::surroundingNodes(bx,idim), flag);
+                    }
+                    bcent[mfi].toFab(bcentfab, bx, flag);
                     amrex_mlndlap_set_integral_eb(BL_TO_FORTRAN_BOX(bx),
                                                   BL_TO_FORTRAN_ANYD(gfab),
                                                   BL_TO_FORTRAN_ANYD(flag),
                                                   BL_TO_FORTRAN_ANYD(vfrac[mfi]),
-                                                  AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*area[0])[mfi]),
-                                                               BL_TO_FORTRAN_ANYD((*area[1])[mfi]),
-                                                               BL_TO_FORTRAN_ANYD((*area[2])[mfi])),
-                                                  BL_TO_FORTRAN_ANYD(bcent[mfi]));
+                                                  AMREX_D_DECL(BL_TO_FORTRAN_ANYD(areafab[0]),
+                                                               BL_TO_FORTRAN_ANYD(areafab[1]),
+                                                               BL_TO_FORTRAN_ANYD(areafab[2])),
+                                                  BL_TO_FORTRAN_ANYD(bcentfab));
                 }
             }
+            }
         }
     }
 #else
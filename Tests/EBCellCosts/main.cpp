@@ -0,0 +1,144 @@
+#include <AMReX.H>
+#include <AMReX_Print.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Utility.H>
+#include <AMReX_EB2.H>
+#include <AMReX_EB2_IF.H>
+#include <AMReX_EBAmrUtil.H>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <queue>
+
+using namespace amrex;
+
+//
+// Time each box of a sphere geometry with synthetic costs per regular,
+// cut and covered cell, and check that EBFitCellCosts gets the costs
+// back.  Then assign the boxes to nprocs processes by their cell counts
+// and by the fitted costs, and check that the fitted costs balance the
+// synthetic load better.  The assignment is done here, greedily, since
+// the knapsack of DistributionMapping uses the actual number of
+// processes, which is one in a serial run.
+//
+
+namespace {
+
+// Largest load over the average load when the boxes are given, in
+// decreasing order of weight, to the process with the least weight so far.
+Real greedy_imbalance (const Vector<Real>& weight, const Vector<Real>& load, int nprocs)
+{
+    Vector<int> order(weight.size());
+    for (int i = 0; i < order.size(); ++i) order[i] = i;
+    std::sort(order.begin(), order.end(),
+              [&] (int a, int b) { return weight[a] > weight[b]; });
+
+    typedef std::pair<Real,int> WP;
+    std::priority_queue<WP, std::vector<WP>, std::greater<WP> > procs;
+    for (int p = 0; p < nprocs; ++p) procs.push(WP(0.0,p));
+
+    Vector<Real> proc_load(nprocs, 0.0);
+    Real total = 0.0;
+    for (int i : order) {
+        WP wp = procs.top();
+        procs.pop();
+        wp.first += weight[i];
+        proc_load[wp.second] += load[i];
+        total += load[i];
+        procs.push(wp);
+    }
+    return *std::max_element(proc_load.begin(), proc_load.end()) / (total/nprocs);
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+    {
+        int n_cell = 64;
+        int max_grid_size = 8;
+        int nprocs = 16;
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("max_grid_size", max_grid_size);
+            pp.query("nprocs", nprocs);
+        }
+
+        Geometry geom;
+        {
+            RealBox rb({AMREX_D_DECL(0.,0.,0.)}, {AMREX_D_DECL(1.,1.,1.)});
+            Array<int,AMREX_SPACEDIM> is_periodic{AMREX_D_DECL(0,0,0)};
+            Box domain(IntVect(AMREX_D_DECL(0,0,0)),
+                       IntVect(AMREX_D_DECL(n_cell-1,n_cell-1,n_cell-1)));
+            geom.define(domain, &rb, CoordSys::cartesian, is_periodic.data());
+        }
+
+        EB2::SphereIF sphere(0.35, {AMREX_D_DECL(0.5,0.5,0.5)}, false);
+        EB2::Build(EB2::makeShop(sphere), geom, 0, 0);
+
+        BoxArray ba(geom.Domain());
+        ba.maxSize(max_grid_size);
+        DistributionMapping dm(ba);
+        FabArray<EBCellFlagFab> flags(ba, dm, 1, 0);
+        EB2::IndexSpace::top().getLevel(geom).fillEBCellFlag(flags, geom);
+
+        LayoutData<Array<long,3> > counts;
+        EBCountCells(counts, flags);
+
+        EBCellCosts exact;
+        exact.regular = 2.0e-8;
+        exact.cut     = 1.3e-7;
+        exact.covered = 1.0e-9;
+
+        LayoutData<Real> box_time(ba, dm);
+        LayoutData<Real> noisy_time(ba, dm);
+        for (MFIter mfi(flags); mfi.isValid(); ++mfi) {
+            const Array<long,3>& n = counts[mfi];
+            AMREX_ALWAYS_ASSERT(n[0]+n[1]+n[2] == mfi.validbox().numPts());
+            box_time[mfi] = n[0]*exact.regular + n[1]*exact.cut + n[2]*exact.covered;
+            noisy_time[mfi] = box_time[mfi] * (0.98 + 0.04*amrex::Random());
+        }
+
+        // Exact timings give the exact ratios, and noisy ones ratios
+        // within a few percent.
+        const EBCellCosts fit = EBFitCellCosts(flags, box_time);
+        AMREX_ALWAYS_ASSERT(fit.regular == 1.0);
+        AMREX_ALWAYS_ASSERT(std::abs(fit.cut - exact.cut/exact.regular) < 1.e-8*fit.cut);
+        AMREX_ALWAYS_ASSERT(std::abs(fit.covered - exact.covered/exact.regular) < 1.e-8);
+
+        const EBCellCosts noisy_fit = EBFitCellCosts(flags, noisy_time);
+        AMREX_ALWAYS_ASSERT(std::abs(noisy_fit.cut/fit.cut - 1.0) < 0.05);
+        AMREX_ALWAYS_ASSERT(std::abs(noisy_fit.covered - fit.covered) < 0.05);
+
+        // The weights of EBCellCostWeights add up to the cost of each box.
+        MultiFab weight(ba, dm, 1, 0);
+        EBCellCostWeights(weight, flags, fit);
+        for (MFIter mfi(weight); mfi.isValid(); ++mfi) {
+            const Real w = weight[mfi].sum(mfi.validbox(), 0);
+            AMREX_ALWAYS_ASSERT(std::abs(w*exact.regular - box_time[mfi]) < 1.e-8*box_time[mfi]);
+        }
+
+        Vector<Real> load, npts_weight, cost_weight;
+        for (MFIter mfi(flags); mfi.isValid(); ++mfi) {
+            const Array<long,3>& n = counts[mfi];
+            load.push_back(box_time[mfi]);
+            npts_weight.push_back(mfi.validbox().numPts());
+            cost_weight.push_back(n[0]*noisy_fit.regular + n[1]*noisy_fit.cut
+                                  + n[2]*noisy_fit.covered);
+        }
+        const Real npts_imbalance = greedy_imbalance(npts_weight, load, nprocs);
+        const Real cost_imbalance = greedy_imbalance(cost_weight, load, nprocs);
+        AMREX_ALWAYS_ASSERT(cost_imbalance < npts_imbalance);
+        AMREX_ALWAYS_ASSERT(cost_imbalance < 1.1);
+
+        amrex::Print() << "EBCellCosts: fitted cut " << noisy_fit.cut
+                       << " covered " << noisy_fit.covered
+                       << ", load imbalance on " << nprocs << " processes "
+                       << npts_imbalance << " by cells, " << cost_imbalance
+                       << " by cost, passed\n";
+    }
+    amrex::Finalize();
+}
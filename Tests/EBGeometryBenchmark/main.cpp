@@ -0,0 +1,184 @@
+#include <AMReX.H>
+#include <AMReX_Print.H>
+#include <AMReX_FArrayBox.H>
+#include <AMReX_Geometry.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_EB2.H>
+#include <AMReX_EB2_IF.H>
+
+#include <iomanip>
+
+using namespace amrex;
+
+//
+// Evaluate an implicit function at the nodes of the domain chopped into
+// boxes of max_grid_size, one point at a time with operator() and in
+// batches with GeometryShop::fillFab, and report points per second.
+// Then time EB2::Build.
+//
+template <class F>
+void time_geometry (const std::string& name, const F& f, const Geometry& geom,
+                    long iters, int max_grid_size)
+{
+    const Real* problo = geom.ProbLo();
+    const Real* dx = geom.CellSize();
+
+    BoxArray ba(geom.Domain());
+    ba.maxSize(max_grid_size);
+    ba.surroundingNodes();
+
+    auto gshop = EB2::makeShop(f);
+
+    Vector<FArrayBox> scalar(ba.size()), batched(ba.size());
+    for (int ib = 0; ib < ba.size(); ++ib) {
+        scalar[ib].resize(ba[ib]);
+        batched[ib].resize(ba[ib]);
+    }
+
+    double tscalar = second();
+    for (long it = 0; it < iters; ++it) {
+        for (int ib = 0; ib < ba.size(); ++ib) {
+            const Box& bx = ba[ib];
+            const auto len = amrex::length(bx);
+            const auto lo  = amrex::lbound(bx);
+            const auto dp  = scalar[ib].view(lo);
+            for         (int k = 0; k < len.z; ++k) {
+                for     (int j = 0; j < len.y; ++j) {
+                    for (int i = 0; i < len.x; ++i) {
+                        dp(i,j,k) = f(RealArray{problo[0]+(i+lo.x)*dx[0],
+                                                problo[1]+(j+lo.y)*dx[1],
+                                                problo[2]+(k+lo.z)*dx[2]});
+                    }
+                }
+            }
+        }
+    }
+    tscalar = second() - tscalar;
+
+    double tbatched = second();
+    for (long it = 0; it < iters; ++it) {
+        for (int ib = 0; ib < ba.size(); ++ib) {
+            gshop.fillFab(batched[ib], geom);
+        }
+    }
+    tbatched = second() - tbatched;
+
+    Real maxdiff = 0.0;
+    for (int ib = 0; ib < ba.size(); ++ib) {
+        batched[ib].minus(scalar[ib]);
+        maxdiff = std::max(maxdiff, batched[ib].norm(0));
+    }
+
+    double tbuild = second();
+    EB2::Build(gshop, geom, 0, 0);
+    tbuild = second() - tbuild;
+
+    const double points = double(ba.numPts())*iters;
+    amrex::Print() << "  " << std::left << std::setw(12) << name
+                   << std::setw(12) << points/tscalar << " points/second (scalar), "
+                   << std::setw(12) << points/tbatched << " points/second (batched), "
+                   << "max difference " << maxdiff << ", "
+                   << "EB2::Build " << tbuild << " seconds." << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+
+    long iters = 0;
+    int n_cell = 0;
+    int max_grid_size = 0;
+
+    {
+        ParmParse pp;
+        pp.get("iters", iters);
+        pp.get("n_cell", n_cell);
+        pp.get("max_grid_size", max_grid_size);
+    }
+
+    amrex::Print() << std::endl
+                   << "EB2 implicit function benchmark." << std::endl
+                   << "Domain: " << n_cell << "^3 cells, max_grid_size " << max_grid_size << std::endl
+                   << "Number of iterations of each test: " << iters << std::endl
+                   << "=========================================" << std::endl << std::endl;
+
+    // The geometries of the tutorials are moved to the unit cube.
+    RealBox rb({0.,0.,0.}, {1.,1.,1.});
+    Geometry geom(Box(IntVect(0), IntVect(n_cell-1)), &rb, 0);
+
+    {
+        // Tutorials/EB/GeometryGeneration
+        EB2::SphereIF sphere(0.5, {0.0,0.0,0.0}, false);
+        EB2::BoxIF cube({-0.4,-0.4,-0.4}, {0.4,0.4,0.4}, false);
+        auto cubesphere = EB2::makeIntersection(sphere, cube);
+        EB2::CylinderIF cylinder_x(0.25, 0, {0.0,0.0,0.0}, false);
+        EB2::CylinderIF cylinder_y(0.25, 1, {0.0,0.0,0.0}, false);
+        EB2::CylinderIF cylinder_z(0.25, 2, {0.0,0.0,0.0}, false);
+        auto three_cylinders = EB2::makeUnion(cylinder_x, cylinder_y, cylinder_z);
+        auto csg = EB2::makeDifference(cubesphere, three_cylinders);
+        time_geometry("csg", EB2::translate(csg, {0.5,0.5,0.5}), geom,
+                      iters, max_grid_size);
+    }
+
+    {
+        // Tutorials/EB/Donut
+        EB2::TorusIF donut(10, 5, {30., 30., 30.}, false);
+        const Real radius = 5;
+        const Real tooth_radius = 1.3;
+        const RealArray bite_center{15., 30., 30.};
+        auto tooth = [&] (Real angle) {
+            const Real r = radius - tooth_radius*0.6;
+            return EB2::CylinderIF(tooth_radius, 2, {bite_center[0] + r*std::cos(angle-1.45),
+                                                     bite_center[1] + r*std::sin(angle-1.45),
+                                                     bite_center[2]}, false);
+        };
+        auto bite = EB2::makeUnion(EB2::CylinderIF(radius, 2, bite_center, false),
+                                   tooth(0.0), tooth(0.4), tooth(0.8), tooth(1.2),
+                                   tooth(1.6), tooth(2.0), tooth(2.4), tooth(2.8));
+        auto bite_donut = EB2::makeDifference(donut, bite);
+        time_geometry("donut", EB2::scale(bite_donut, {1./60.,1./60.,1./60.}), geom,
+                      iters, max_grid_size);
+    }
+
+    {
+        // Tutorials/EB/CNS/Exec/Combustor
+        EB2::PlaneIF farwall({2.25,0.,0.}, {1.,0.,0.});
+        auto ramp = EB2::makeIntersection(EB2::PlaneIF({1.25, 3.75, 0.}, {  0., -1.  , 0.}),
+                                          EB2::PlaneIF({1.25, 3.75, 0.}, {3.45, -0.95, 0.}),
+                                          EB2::PlaneIF({0.5 , 0.  , 0.}, {  1.,  0.  , 0.}));
+        EB2::BoxIF pipe({0.3, -5.0, -1.}, {0.5, 2.5, 1.}, false);
+        const Real k2 = 3.45/0.95;
+        const Real secty = 3.75 + k2*(0.5-1.25);
+        const Real dycut = 4.*std::min(5.0/n_cell, k2*5.0/n_cell);
+        EB2::BoxIF flat_corner({0.5, 0., -1.}, {1.e10, secty+dycut, 1.}, false);
+        auto polys = EB2::makeUnion(farwall, ramp, pipe, flat_corner);
+        auto pr = EB2::translate(EB2::lathe(polys), {2.5, 2.5, 0.});
+        time_geometry("combustor", EB2::scale(pr, {0.2,0.2,0.2}), geom,
+                      iters, max_grid_size);
+    }
+
+    {
+        // Tutorials/EB/LevelSet, capped cylinder along y
+        const Real radius = 0.2, length = 0.8;
+        const RealArray offset{0.5, 0.1, 0.5};
+        Vector<EB2::PolyTerm> poly;
+        for (int idir = 0; idir < 3; ++idir) {
+            const Vector<Real> coefvec = (idir == 1) ? Vector<Real>{-radius*radius, 0., 0.}
+                                                     : Vector<Real>{0., 0., 1.};
+            for (int lc = 0; lc < 3; ++lc) {
+                IntVect powers = IntVect::TheZeroVector();
+                powers[idir] = lc;
+                poly.push_back(EB2::PolyTerm{coefvec[lc], powers});
+            }
+        }
+        auto walls = EB2::translate(EB2::makeUnion(EB2::PlaneIF({0.,0.,0.}, {0., 1.,0.}, false),
+                                                   EB2::PlaneIF({0.,length,0.}, {0.,-1.,0.}, false)),
+                                    offset);
+        auto cylinder = EB2::translate(EB2::PolynomialIF(poly), offset);
+        auto capped = EB2::makeIntersection(walls, cylinder);
+        time_geometry("cylinder", capped, geom,
+                      iters, max_grid_size);
+    }
+
+    amrex::Finalize();
+}
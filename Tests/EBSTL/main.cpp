@@ -0,0 +1,154 @@
+#include <AMReX.H>
+#include <AMReX_Print.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Utility.H>
+#include <AMReX_EB2_IF_STL.H>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <string>
+
+using namespace amrex;
+
+//
+// Load a cube from an STL file with EB2::STLIF and check the signed
+// distance against the exact one.  The unit cube in stl_file is scaled
+// and shifted to [-1,1]^3, with the body inside, so phi is positive
+// inside the cube and negative outside.  This covers the ASCII and
+// binary readers, the nearest triangle search in the tree, the inside
+// test, the band cut-off and range().
+//
+
+namespace {
+
+// phi of the body [-1,1]^3
+Real exact_phi (const RealArray& p)
+{
+    Real q[3], out2 = 0.0, qmax = std::numeric_limits<Real>::lowest();
+    for (int d = 0; d < 3; ++d) {
+        q[d] = std::abs(p[d]) - 1.0;
+        out2 += std::max(q[d],0.0)*std::max(q[d],0.0);
+        qmax = std::max(qmax,q[d]);
+    }
+    return -(std::sqrt(out2) + std::min(qmax,0.0));
+}
+
+RealArray random_point (Real lo, Real hi)
+{
+    return {lo+(hi-lo)*amrex::Random(), lo+(hi-lo)*amrex::Random(), lo+(hi-lo)*amrex::Random()};
+}
+
+// Write the triangles of an ASCII STL file as a binary STL file.
+void write_binary (const std::string& ascii, const std::string& binary)
+{
+    std::ifstream is(ascii);
+    Vector<float> v;
+    std::string word;
+    while (is >> word) {
+        if (word == "vertex") {
+            float x[3];
+            is >> x[0] >> x[1] >> x[2];
+            v.insert(v.end(), x, x+3);
+        }
+    }
+    const std::uint32_t ntri = v.size()/9;
+    AMREX_ALWAYS_ASSERT(ntri*9 == v.size());
+
+    std::ofstream os(binary, std::ios::binary);
+    const char header[80] = "binary copy of an ASCII STL file";
+    os.write(header, 80);
+    os.write(reinterpret_cast<const char*>(&ntri), 4);
+    for (std::uint32_t t = 0; t < ntri; ++t) {
+        const float normal[3] = {0.f, 0.f, 0.f};
+        const std::uint16_t attr = 0;
+        os.write(reinterpret_cast<const char*>(normal), sizeof(normal));
+        os.write(reinterpret_cast<const char*>(&v[9*t]), 9*sizeof(float));
+        os.write(reinterpret_cast<const char*>(&attr), sizeof(attr));
+    }
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+    {
+        std::string stl_file = "cube.stl";
+        int npoints = 10000;
+        {
+            ParmParse pp;
+            pp.query("stl_file", stl_file);
+            pp.query("npoints", npoints);
+        }
+
+        const RealArray offset{-1.0,-1.0,-1.0};
+        EB2::STLIF body(stl_file, 2.0, offset, false);
+
+        AMREX_ALWAYS_ASSERT(body.numTriangles() == 12);
+        RealArray lo, hi;
+        body.boundingBox(lo, hi);
+        for (int d = 0; d < 3; ++d) {
+            AMREX_ALWAYS_ASSERT(lo[d] == -1.0 && hi[d] == 1.0);
+        }
+
+        // Points with known distances: inside, on a face, off a face,
+        // an edge and a corner.
+        const Real tol = 1.e-12;
+        const RealArray known_p[] = {{0.0,0.0,0.0}, {0.5,0.0,0.0}, {0.9,0.9,0.9},
+                                     {1.0,0.2,-0.3}, {2.0,0.0,0.0}, {2.0,2.0,0.0},
+                                     {-2.0,-2.0,-2.0}};
+        const Real known_phi[] = {1.0, 0.5, 0.1,
+                                  0.0, -1.0, -std::sqrt(2.0),
+                                  -std::sqrt(3.0)};
+        for (int i = 0; i < 7; ++i) {
+            AMREX_ALWAYS_ASSERT(std::abs(body(known_p[i]) - known_phi[i]) < tol);
+        }
+
+        const std::string binary_file = "cube_binary.stl";
+        if (ParallelDescriptor::IOProcessor()) write_binary(stl_file, binary_file);
+        ParallelDescriptor::Barrier();
+
+        EB2::STLIF fluid(stl_file, 2.0, offset, true);
+        EB2::STLIF body_binary(binary_file, 2.0, offset, false);
+        const Real band = 0.25;
+        EB2::STLIF body_band(stl_file, 2.0, offset, false, band);
+
+        AMREX_ALWAYS_ASSERT(body_binary.numTriangles() == 12);
+
+        Real maxerr = 0.0;
+        for (int i = 0; i < npoints; ++i) {
+            const RealArray p = random_point(-2.0, 2.0);
+            const Real phi = body(p);
+            const Real ex  = exact_phi(p);
+            maxerr = std::max(maxerr, std::abs(phi-ex));
+
+            AMREX_ALWAYS_ASSERT(fluid(p) == -phi);
+            AMREX_ALWAYS_ASSERT(body_binary(p) == phi);
+            AMREX_ALWAYS_ASSERT(std::abs(body_band(p) - std::copysign(std::min(std::abs(ex),band),ex))
+                                < tol);
+        }
+        AMREX_ALWAYS_ASSERT(maxerr < tol);
+
+        // range() has to contain the values in the box.
+        for (int i = 0; i < npoints/10; ++i) {
+            const RealArray blo = random_point(-2.0, 1.5);
+            const RealArray bhi{blo[0]+0.5*amrex::Random(), blo[1]+0.5*amrex::Random(),
+                                blo[2]+0.5*amrex::Random()};
+            const EB2::Interval r = body.range(blo, bhi);
+            for (int j = 0; j < 8; ++j) {
+                const RealArray p{(j&1) ? bhi[0] : blo[0],
+                                  (j&2) ? bhi[1] : blo[1],
+                                  (j&4) ? bhi[2] : blo[2]};
+                const Real phi = body(p);
+                AMREX_ALWAYS_ASSERT(phi >= r.lo-tol && phi <= r.hi+tol);
+            }
+        }
+
+        amrex::Print() << "EBSTL: " << npoints << " points, max error " << maxerr
+                       << ", passed\n";
+    }
+    amrex::Finalize();
+}
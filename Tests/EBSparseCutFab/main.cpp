@@ -0,0 +1,185 @@
+#include <AMReX.H>
+#include <AMReX_Print.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_EB2.H>
+#include <AMReX_EB2_IF.H>
+#include <AMReX_EBFabFactory.H>
+#include <AMReX_MultiCutFab.H>
+#include <AMReX_SparseCutFab.H>
+
+#include <cstring>
+#include <string>
+
+using namespace amrex;
+
+//
+// Fill the EB data of a sphere geometry into MultiCutFabs, the way
+// EBDataCollection stored them before it kept them sparse, and check
+// that the sparse data of EBFArrayBoxFactory give them back bit for
+// bit: through the dense getters, through SparseCutFab::toFab on the
+// whole fab, including the ghost cells, and through ToMultiFab with the
+// regular and covered defaults on the boxes that have no cut cells.
+//
+
+namespace {
+
+bool same (const FArrayBox& a, const FArrayBox& b)
+{
+    return a.box() == b.box() && a.nComp() == b.nComp()
+        && std::memcmp(a.dataPtr(), b.dataPtr(), a.size()*sizeof(Real)) == 0;
+}
+
+// Returns the number of points stored by the sparse data.
+long check (const std::string& name, const MultiCutFab& old_data,
+            const MultiSparseCutFab& sparse, const MultiCutFab& dense)
+{
+    const auto& flags = sparse.cellFlags();
+    AMREX_ALWAYS_ASSERT(sparse.boxArray() == old_data.boxArray());
+    AMREX_ALWAYS_ASSERT(sparse.nComp() == old_data.nComp());
+    AMREX_ALWAYS_ASSERT(sparse.nGrow() == old_data.nGrow());
+
+    long nstored = 0;
+    FArrayBox fab;
+    for (MFIter mfi(flags); mfi.isValid(); ++mfi)
+    {
+        AMREX_ALWAYS_ASSERT(sparse.ok(mfi) == old_data.ok(mfi));
+        AMREX_ALWAYS_ASSERT(dense.ok(mfi) == old_data.ok(mfi));
+        if (!old_data.ok(mfi)) continue;
+
+        const FArrayBox& ref = old_data[mfi];
+        const SparseCutFab& s = sparse[mfi];
+        AMREX_ALWAYS_ASSERT(s.box() == ref.box());
+
+        s.toFab(fab, ref.box(), flags[mfi]);
+        AMREX_ALWAYS_ASSERT_WITH_MESSAGE(same(fab, ref), (name+" toFab").c_str());
+        AMREX_ALWAYS_ASSERT_WITH_MESSAGE(same(dense[mfi], ref), (name+" dense getter").c_str());
+
+        // A point that is not stored has the default of its cells.
+        for (IntVect iv = ref.box().smallEnd(); ref.box().contains(iv); ref.box().next(iv)) {
+            if (s.find(iv) < 0) {
+                for (int n = 0; n < ref.nComp(); ++n) {
+                    AMREX_ALWAYS_ASSERT(ref(iv,n) == s.defaultValue(iv, flags[mfi]));
+                }
+            }
+        }
+        nstored += s.size();
+    }
+
+    const Real regval = sparse.regularValue();
+    const Real covval = sparse.coveredValue();
+    MultiFab mf_old = old_data.ToMultiFab(regval, covval);
+    MultiFab mf_new = sparse.ToMultiFab(regval, covval);
+    for (MFIter mfi(mf_old); mfi.isValid(); ++mfi) {
+        AMREX_ALWAYS_ASSERT_WITH_MESSAGE(same(mf_new[mfi], mf_old[mfi]),
+                                         (name+" ToMultiFab").c_str());
+    }
+
+    return nstored;
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+    {
+        int n_cell = 32;
+        int max_grid_size = 4;
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("max_grid_size", max_grid_size);
+        }
+
+        Geometry geom;
+        {
+            RealBox rb({AMREX_D_DECL(0.,0.,0.)}, {AMREX_D_DECL(1.,1.,1.)});
+            Array<int,AMREX_SPACEDIM> is_periodic{AMREX_D_DECL(0,0,0)};
+            Box domain(IntVect(AMREX_D_DECL(0,0,0)),
+                       IntVect(AMREX_D_DECL(n_cell-1,n_cell-1,n_cell-1)));
+            geom.define(domain, &rb, CoordSys::cartesian, is_periodic.data());
+        }
+
+        // The sphere leaves regular, cut and covered boxes.
+        EB2::SphereIF sphere(0.4, {AMREX_D_DECL(0.5,0.5,0.5)}, false);
+        EB2::Build(EB2::makeShop(sphere), geom, 0, 0);
+        const EB2::Level& eblev = EB2::IndexSpace::top().getLevel(geom);
+
+        BoxArray ba(geom.Domain());
+        ba.maxSize(max_grid_size);
+        DistributionMapping dm(ba);
+
+        const int ng = 2;
+        EBFArrayBoxFactory factory(eblev, geom, ba, dm, {ng,ng,ng}, EBSupport::full);
+        const auto& flags = factory.getMultiEBCellFlagFab();
+
+        int ntypes[3] = {0,0,0};
+        for (MFIter mfi(flags); mfi.isValid(); ++mfi) {
+            const FabType t = flags[mfi].getType();
+            ++ntypes[(t == FabType::regular) ? 0 : ((t == FabType::covered) ? 2 : 1)];
+        }
+        AMREX_ALWAYS_ASSERT(ntypes[0] > 0 && ntypes[1] > 0 && ntypes[2] > 0);
+
+        long nstored = 0;
+        long npts = 0;
+
+        {
+            MultiCutFab centroid(ba, dm, AMREX_SPACEDIM, ng, flags);
+            eblev.fillCentroid(centroid, geom);
+            nstored += check("centroid", centroid, factory.getSparseCentroid(),
+                             factory.getCentroid());
+        }
+
+        {
+            MultiCutFab bndrycent(ba, dm, AMREX_SPACEDIM, ng, flags);
+            eblev.fillBndryCent(bndrycent, geom);
+            nstored += check("bndrycent", bndrycent, factory.getSparseBndryCent(),
+                             factory.getBndryCent());
+        }
+
+        {
+            MultiCutFab bndryarea(ba, dm, 1, ng, flags);
+            eblev.fillBndryArea(bndryarea, geom);
+            nstored += check("bndryarea", bndryarea, factory.getSparseBndryArea(),
+                             factory.getBndryArea());
+        }
+
+        {
+            MultiCutFab bndrynorm(ba, dm, AMREX_SPACEDIM, ng, flags);
+            eblev.fillBndryNorm(bndrynorm, geom);
+            nstored += check("bndrynorm", bndrynorm, factory.getSparseBndryNormal(),
+                             factory.getBndryNormal());
+        }
+
+        Array<std::unique_ptr<MultiCutFab>,AMREX_SPACEDIM> areafrac, facecent;
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            const BoxArray& faceba = amrex::convert(ba, IntVect::TheDimensionVector(idim));
+            areafrac[idim].reset(new MultiCutFab(faceba, dm, 1, ng, flags));
+            facecent[idim].reset(new MultiCutFab(faceba, dm, AMREX_SPACEDIM-1, ng, flags));
+        }
+        eblev.fillAreaFrac({AMREX_D_DECL(areafrac[0].get(),areafrac[1].get(),areafrac[2].get())}, geom);
+        eblev.fillFaceCent({AMREX_D_DECL(facecent[0].get(),facecent[1].get(),facecent[2].get())}, geom);
+
+        const auto& sparse_area = factory.getSparseAreaFrac();
+        const auto& sparse_fcent = factory.getSparseFaceCent();
+        const auto& dense_area = factory.getAreaFrac();
+        const auto& dense_fcent = factory.getFaceCent();
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            const std::string d = std::to_string(idim);
+            nstored += check("areafrac "+d, *areafrac[idim], *sparse_area[idim], *dense_area[idim]);
+            nstored += check("facecent "+d, *facecent[idim], *sparse_fcent[idim], *dense_fcent[idim]);
+        }
+
+        for (MFIter mfi(flags); mfi.isValid(); ++mfi) {
+            if (factory.getSparseCentroid().ok(mfi)) {
+                npts += flags[mfi].box().numPts();
+            }
+        }
+
+        amrex::Print() << "EBSparseCutFab: " << ntypes[0] << " regular, " << ntypes[1]
+                       << " cut and " << ntypes[2] << " covered boxes, " << nstored
+                       << " points stored in all the arrays for " << npts
+                       << " cells of cut boxes, passed\n";
+    }
+    amrex::Finalize();
+}
@@ -0,0 +1,99 @@
+#include <AMReX.H>
+#include <AMReX_Print.H>
+#include <AMReX_FArrayBox.H>
+#include <AMReX_Geometry.H>
+#include <AMReX_Interpolater.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Utility.H>
+
+#include <iomanip>
+
+using namespace amrex;
+
+//
+// Time one interpolater filling a cubic fine box of length boxsize
+// from random coarse data, and report fine cells (times components)
+// per second.
+//
+void time_interp (const std::string& name, Interpolater& interp, bool nodal,
+                  long iters, int boxsize, int ncomps, const IntVect& ratio)
+{
+    Box fbx(IntVect(0), IntVect(boxsize-1));
+    if (nodal) fbx.surroundingNodes();
+
+    Box cdomain = amrex::coarsen(Box(IntVect(0), IntVect(boxsize-1)), ratio);
+    RealBox rb(AMREX_D_DECL(0.,0.,0.), AMREX_D_DECL(1.,1.,1.));
+    Geometry cgeom(cdomain, &rb, 0);
+    Geometry fgeom(amrex::refine(cdomain,ratio), &rb, 0);
+
+    Box cbx = interp.CoarseBox(fbx, ratio);
+    FArrayBox crse(cbx, ncomps);
+    for (int n = 0; n < ncomps; ++n) {
+        for (BoxIterator bi(cbx); bi.ok(); ++bi) {
+            crse(bi(),n) = amrex::Random();
+        }
+    }
+    FArrayBox fine(fbx, ncomps);
+
+    Vector<BCRec> bcr(ncomps);
+    for (int n = 0; n < ncomps; ++n) {
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            bcr[n].setLo(d, BCType::ext_dir);
+            bcr[n].setHi(d, BCType::foextrap);
+        }
+    }
+
+    // Warm up.
+    interp.interp(crse,0,fine,0,ncomps,fbx,ratio,cgeom,fgeom,bcr,0,0);
+
+    double timer = second();
+    for (long i = 0; i < iters; ++i)
+    {
+        interp.interp(crse,0,fine,0,ncomps,fbx,ratio,cgeom,fgeom,bcr,0,0);
+    }
+    timer = second() - timer;
+
+    const double cells = double(fbx.numPts())*ncomps*iters;
+    amrex::Print() << "  " << std::left << std::setw(28) << name
+                   << " ratio " << ratio[0]
+                   << ": " << std::setw(12) << timer/iters << " seconds/iter, "
+                   << cells/timer << " cells/second." << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+
+    long iters = 0;
+    int boxsize = 0;
+    int ncomps = 0;
+    Vector<int> ratios {2, 4};
+
+    {
+        ParmParse pp;
+        pp.get("iters", iters);
+        pp.get("boxsize",boxsize);
+        pp.get("ncomps", ncomps);
+        pp.queryarr("ratios", ratios);
+    }
+
+    amrex::Print() << std::endl
+                   << "Interpolater benchmark." << std::endl
+                   << "Cubic fine boxes of length: " << boxsize << std::endl
+                   << "Number of components: " << ncomps << std::endl
+                   << "Number of iterations of each test: " << iters << std::endl
+                   << "=========================================" << std::endl << std::endl;
+
+    for (int r : ratios)
+    {
+        const IntVect ratio(r);
+        time_interp("PCInterp",                  pc_interp,            false, iters, boxsize, ncomps, ratio);
+        time_interp("NodeBilinear",              node_bilinear_interp, true,  iters, boxsize, ncomps, ratio);
+        time_interp("CellConservativeLinear",    lincc_interp,         false, iters, boxsize, ncomps, ratio);
+        time_interp("CellConservativeLinear(0)", cell_cons_interp,     false, iters, boxsize, ncomps, ratio);
+        time_interp("CellConservativeProtected", protected_interp,     false, iters, boxsize, ncomps, ratio);
+        amrex::Print() << std::endl;
+    }
+
+    amrex::Finalize();
+}
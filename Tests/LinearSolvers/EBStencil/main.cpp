@@ -0,0 +1,411 @@
+#include <AMReX.H>
+#include <AMReX_Print.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_EB2.H>
+#include <AMReX_EBFabFactory.H>
+#include <AMReX_MLEBABecLap.H>
+
+#include "EBStencil_F.H"
+
+#include <cmath>
+
+using namespace amrex;
+
+//
+// Compare the cut-cell stencils that MLEBABecLap stores in
+// prepareForSolve against the kernels that recomputed them from the EB
+// geometry in every apply and smoothing sweep (ebstencil_f.F90).  The
+// domain is cut by the EB on all faces, so the weights of the physical
+// boundary values used by the smoother are exercised too.  The operator
+// with a Neumann EB is checked on every MG level; the one with an
+// inhomogeneous Dirichlet EB on the finest level, where its EB
+// coefficients are the ones passed to setEBDirichlet.
+//
+
+namespace {
+
+// Gives access to the apply and smooth of the stored stencils, and
+// runs the reference kernels on the same data.
+class TestEBABecLap
+    : public MLEBABecLap
+{
+public:
+    using MLEBABecLap::MLEBABecLap;
+
+    void setup () { prepareForSolve(); }
+
+    int numMGLevels () const { return NMGLevels(0); }
+
+    const BoxArray& grids (int mglev) const { return m_grids[0][mglev]; }
+    const DistributionMapping& dmap (int mglev) const { return m_dmap[0][mglev]; }
+    const EBFArrayBoxFactory& factory (int mglev) const {
+        return dynamic_cast<EBFArrayBoxFactory const&>(*m_factory[0][mglev]);
+    }
+
+    // Fills the ghost cells of x and the boundary values of the smoother.
+    void fillBC (int mglev, MultiFab& x) const {
+        applyBC(0, mglev, x, BCMode::Homogeneous, StateMode::Solution);
+    }
+
+    void storedApply (int mglev, MultiFab& out, const MultiFab& in) const {
+        Fapply(0, mglev, out, in);
+    }
+
+    void storedSmooth (int mglev, MultiFab& sol, const MultiFab& rhs, int redblack) const {
+        Fsmooth(0, mglev, sol, rhs, redblack);
+    }
+
+    // The reference kernels only update the fabs with cut cells.
+    void refApply (int mglev, MultiFab& out, const MultiFab& in,
+                   const MultiFab* beb, const MultiFab* phieb) const;
+    void refSmooth (int mglev, MultiFab& sol, const MultiFab& rhs, int redblack,
+                    const MultiFab* beb) const;
+
+private:
+
+    iMultiFab makeCCMask (int mglev) const;
+};
+
+iMultiFab
+TestEBABecLap::makeCCMask (int mglev) const
+{
+    const BoxArray& ba = m_grids[0][mglev];
+    iMultiFab mask(ba, m_dmap[0][mglev], 1, 1);
+    mask.setVal(0);
+    const std::vector<IntVect>& pshifts = m_geom[0][mglev].periodicity().shiftIntVect();
+    std::vector< std::pair<int,Box> > isects;
+    for (MFIter mfi(mask); mfi.isValid(); ++mfi)
+    {
+        IArrayBox& fab = mask[mfi];
+        const Box& bx = fab.box();
+        for (const auto& iv : pshifts)
+        {
+            ba.intersections(bx+iv, isects);
+            for (const auto& is : isects) {
+                fab.setVal(1, is.second-iv);
+            }
+        }
+    }
+    return mask;
+}
+
+void
+TestEBABecLap::refApply (int mglev, MultiFab& out, const MultiFab& in,
+                         const MultiFab* beb, const MultiFab* phieb) const
+{
+    const MultiFab& acoef = *getACoeffs(0, mglev);
+    const auto bcoef = getBCoeffs(0, mglev);
+    const iMultiFab ccmask = makeCCMask(mglev);
+    const Real* dxinv = m_geom[0][mglev].InvCellSize();
+
+    const EBFArrayBoxFactory& fact = factory(mglev);
+    const auto& flags = fact.getMultiEBCellFlagFab();
+    const MultiFab& vfrac = fact.getVolFrac();
+    const auto area = fact.getAreaFrac();
+    const auto fcent = fact.getFaceCent();
+    const MultiCutFab& barea = fact.getBndryArea();
+    const MultiCutFab& bcent = fact.getBndryCent();
+
+    const int is_eb_dirichlet = beb != nullptr;
+    const int is_inhomog = phieb != nullptr;
+    FArrayBox foo(Box::TheUnitBox());
+
+    for (MFIter mfi(out); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.validbox();
+        if (flags[mfi].getType(bx) != FabType::singlevalued) continue;
+
+        FArrayBox const& bebfab = (beb) ? (*beb)[mfi] : foo;
+        FArrayBox const& phiebfab = (phieb) ? (*phieb)[mfi] : foo;
+
+        ebstencil_ref_adotx(BL_TO_FORTRAN_BOX(bx),
+                            BL_TO_FORTRAN_ANYD(out[mfi]),
+                            BL_TO_FORTRAN_ANYD(in[mfi]),
+                            BL_TO_FORTRAN_ANYD(acoef[mfi]),
+                            AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*bcoef[0])[mfi]),
+                                         BL_TO_FORTRAN_ANYD((*bcoef[1])[mfi]),
+                                         BL_TO_FORTRAN_ANYD((*bcoef[2])[mfi])),
+                            BL_TO_FORTRAN_ANYD(ccmask[mfi]),
+                            BL_TO_FORTRAN_ANYD(flags[mfi]),
+                            BL_TO_FORTRAN_ANYD(vfrac[mfi]),
+                            AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*area[0])[mfi]),
+                                         BL_TO_FORTRAN_ANYD((*area[1])[mfi]),
+                                         BL_TO_FORTRAN_ANYD((*area[2])[mfi])),
+                            AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*fcent[0])[mfi]),
+                                         BL_TO_FORTRAN_ANYD((*fcent[1])[mfi]),
+                                         BL_TO_FORTRAN_ANYD((*fcent[2])[mfi])),
+                            BL_TO_FORTRAN_ANYD(barea[mfi]),
+                            BL_TO_FORTRAN_ANYD(bcent[mfi]),
+                            BL_TO_FORTRAN_ANYD(bebfab), is_eb_dirichlet,
+                            BL_TO_FORTRAN_ANYD(phiebfab), is_inhomog,
+                            dxinv, getAScalar(), getBScalar());
+    }
+}
+
+void
+TestEBABecLap::refSmooth (int mglev, MultiFab& sol, const MultiFab& rhs, int redblack,
+                          const MultiFab* beb) const
+{
+    const MultiFab& acoef = *getACoeffs(0, mglev);
+    const auto bcoef = getBCoeffs(0, mglev);
+    const iMultiFab ccmask = makeCCMask(mglev);
+    const Real* dxinv = m_geom[0][mglev].InvCellSize();
+    const auto& undrrelxr = m_undrrelxr[0][mglev];
+    const auto& maskvals  = m_maskvals [0][mglev];
+
+    const EBFArrayBoxFactory& fact = factory(mglev);
+    const auto& flags = fact.getMultiEBCellFlagFab();
+    const MultiFab& vfrac = fact.getVolFrac();
+    const auto area = fact.getAreaFrac();
+    const auto fcent = fact.getFaceCent();
+    const MultiCutFab& barea = fact.getBndryArea();
+    const MultiCutFab& bcent = fact.getBndryCent();
+
+    const int is_eb_dirichlet = beb != nullptr;
+    FArrayBox foo(Box::TheUnitBox());
+
+    OrientationIter oitr;
+    const FabSet& f0 = undrrelxr[oitr()]; ++oitr;
+    const FabSet& f1 = undrrelxr[oitr()]; ++oitr;
+#if (AMREX_SPACEDIM > 1)
+    const FabSet& f2 = undrrelxr[oitr()]; ++oitr;
+    const FabSet& f3 = undrrelxr[oitr()]; ++oitr;
+#if (AMREX_SPACEDIM > 2)
+    const FabSet& f4 = undrrelxr[oitr()]; ++oitr;
+    const FabSet& f5 = undrrelxr[oitr()]; ++oitr;
+#endif
+#endif
+
+    for (MFIter mfi(sol); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.validbox();
+        if (flags[mfi].getType(bx) != FabType::singlevalued) continue;
+
+        FArrayBox const& bebfab = (beb) ? (*beb)[mfi] : foo;
+
+        ebstencil_ref_gsrb(BL_TO_FORTRAN_BOX(bx),
+                           BL_TO_FORTRAN_ANYD(sol[mfi]),
+                           BL_TO_FORTRAN_ANYD(rhs[mfi]),
+                           BL_TO_FORTRAN_ANYD(acoef[mfi]),
+                           AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*bcoef[0])[mfi]),
+                                        BL_TO_FORTRAN_ANYD((*bcoef[1])[mfi]),
+                                        BL_TO_FORTRAN_ANYD((*bcoef[2])[mfi])),
+                           BL_TO_FORTRAN_ANYD(ccmask[mfi]),
+                           AMREX_D_DECL(BL_TO_FORTRAN_ANYD(maskvals[0][mfi]),
+                                        BL_TO_FORTRAN_ANYD(maskvals[2][mfi]),
+                                        BL_TO_FORTRAN_ANYD(maskvals[4][mfi])),
+                           AMREX_D_DECL(BL_TO_FORTRAN_ANYD(maskvals[1][mfi]),
+                                        BL_TO_FORTRAN_ANYD(maskvals[3][mfi]),
+                                        BL_TO_FORTRAN_ANYD(maskvals[5][mfi])),
+                           AMREX_D_DECL(BL_TO_FORTRAN_ANYD(f0[mfi]),
+                                        BL_TO_FORTRAN_ANYD(f2[mfi]),
+                                        BL_TO_FORTRAN_ANYD(f4[mfi])),
+                           AMREX_D_DECL(BL_TO_FORTRAN_ANYD(f1[mfi]),
+                                        BL_TO_FORTRAN_ANYD(f3[mfi]),
+                                        BL_TO_FORTRAN_ANYD(f5[mfi])),
+                           BL_TO_FORTRAN_ANYD(flags[mfi]),
+                           BL_TO_FORTRAN_ANYD(vfrac[mfi]),
+                           AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*area[0])[mfi]),
+                                        BL_TO_FORTRAN_ANYD((*area[1])[mfi]),
+                                        BL_TO_FORTRAN_ANYD((*area[2])[mfi])),
+                           AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*fcent[0])[mfi]),
+                                        BL_TO_FORTRAN_ANYD((*fcent[1])[mfi]),
+                                        BL_TO_FORTRAN_ANYD((*fcent[2])[mfi])),
+                           BL_TO_FORTRAN_ANYD(barea[mfi]),
+                           BL_TO_FORTRAN_ANYD(bcent[mfi]),
+                           BL_TO_FORTRAN_ANYD(bebfab), is_eb_dirichlet,
+                           dxinv, getAScalar(), getBScalar(), redblack);
+    }
+}
+
+// Largest difference between a and b, and largest |b|, over the fabs
+// with cut cells.
+std::pair<Real,Real>
+cutFabDiff (const MultiFab& a, const MultiFab& b, const EBFArrayBoxFactory& fact)
+{
+    const auto& flags = fact.getMultiEBCellFlagFab();
+    Real diff = 0.0, bmax = 0.0;
+    for (MFIter mfi(a); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.validbox();
+        if (flags[mfi].getType(bx) != FabType::singlevalued) continue;
+        for (IntVect iv = bx.smallEnd(); bx.contains(iv); bx.next(iv)) {
+            diff = std::max(diff, std::abs(a[mfi](iv)-b[mfi](iv)));
+            bmax = std::max(bmax, std::abs(b[mfi](iv)));
+        }
+    }
+    ParallelDescriptor::ReduceRealMax(diff);
+    ParallelDescriptor::ReduceRealMax(bmax);
+    return std::make_pair(diff, bmax);
+}
+
+void
+fillRandom (MultiFab& mf)
+{
+    mf.setVal(0.0);
+    for (MFIter mfi(mf); mfi.isValid(); ++mfi) {
+        const Box& bx = mfi.validbox();
+        for (IntVect iv = bx.smallEnd(); bx.contains(iv); bx.next(iv)) {
+            mf[mfi](iv) = amrex::Random();
+        }
+    }
+}
+
+// Checks apply and nsweeps red-black sweeps of the smoother on MG
+// level mglev.  Every sweep starts both versions from the same state.
+void
+check (const TestEBABecLap& op, int mglev, const MultiFab* beb, const MultiFab* phieb,
+       int nsweeps, Real tol, int verbose, const std::string& name)
+{
+    const BoxArray& ba = op.grids(mglev);
+    const DistributionMapping& dm = op.dmap(mglev);
+    const EBFArrayBoxFactory& fact = op.factory(mglev);
+
+    MultiFab x(ba, dm, 1, 1, MFInfo(), fact);
+    MultiFab y(ba, dm, 1, 0, MFInfo(), fact);
+    MultiFab yref(ba, dm, 1, 0, MFInfo(), fact);
+
+    fillRandom(x);
+    op.fillBC(mglev, x);
+    op.storedApply(mglev, y, x);
+    MultiFab::Copy(yref, y, 0, 0, 1, 0);
+    op.refApply(mglev, yref, x, beb, phieb);
+
+    auto r = cutFabDiff(y, yref, fact);
+    if (verbose > 0) {
+        amrex::Print() << "  " << name << " level " << mglev << " apply: max diff "
+                       << r.first << " max |Ax| " << r.second << "\n";
+    }
+    AMREX_ALWAYS_ASSERT(r.second > 0.0 && r.first <= tol*r.second);
+
+    MultiFab sol(ba, dm, 1, 1, MFInfo(), fact);
+    MultiFab solref(ba, dm, 1, 1, MFInfo(), fact);
+    MultiFab rhs(ba, dm, 1, 0, MFInfo(), fact);
+    fillRandom(sol);
+    fillRandom(rhs);
+    rhs.mult(r.second);
+
+    for (int isweep = 0; isweep < nsweeps; ++isweep) {
+        for (int redblack = 0; redblack < 2; ++redblack) {
+            op.fillBC(mglev, sol);
+            MultiFab::Copy(solref, sol, 0, 0, 1, 1);
+            op.storedSmooth(mglev, sol, rhs, redblack);
+            op.refSmooth(mglev, solref, rhs, redblack, beb);
+
+            auto s = cutFabDiff(sol, solref, fact);
+            if (verbose > 0) {
+                amrex::Print() << "  " << name << " level " << mglev << " sweep " << isweep
+                               << " redblack " << redblack << ": max diff " << s.first
+                               << " max |phi| " << s.second << "\n";
+            }
+            AMREX_ALWAYS_ASSERT(s.first <= tol*s.second);
+        }
+    }
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+    {
+        int n_cell = 32;
+        int max_grid_size = 16;
+        int nsweeps = 2;
+        Real tol = 1.e-12;
+        int verbose = 0;
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("max_grid_size", max_grid_size);
+            pp.query("nsweeps", nsweeps);
+            pp.query("tol", tol);
+            pp.query("verbose", verbose);
+        }
+
+        Geometry geom;
+        {
+            RealBox rb({AMREX_D_DECL(0.,0.,0.)}, {AMREX_D_DECL(1.,1.,1.)});
+            Array<int,AMREX_SPACEDIM> is_periodic{AMREX_D_DECL(0,0,0)};
+            Box domain(IntVect(AMREX_D_DECL(0,0,0)),
+                       IntVect(AMREX_D_DECL(n_cell-1,n_cell-1,n_cell-1)));
+            geom.define(domain, &rb, CoordSys::cartesian, is_periodic.data());
+        }
+        EB2::Build(geom, 0, 30);
+
+        BoxArray ba(geom.Domain());
+        ba.maxSize(max_grid_size);
+        DistributionMapping dm(ba);
+        const Real* dx = geom.CellSize();
+
+        const EB2::Level& eb_level = EB2::IndexSpace::top().getLevel(geom);
+        EBFArrayBoxFactory factory(eb_level, geom, ba, dm, {2,2,2}, EBSupport::full);
+
+        MultiFab phi(ba, dm, 1, 1, MFInfo(), factory);
+        MultiFab acoef(ba, dm, 1, 0, MFInfo(), factory);
+        MultiFab beb(ba, dm, 1, 0, MFInfo(), factory);
+        MultiFab phieb(ba, dm, 1, 0, MFInfo(), factory);
+        Array<MultiFab,AMREX_SPACEDIM> bcoef;
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            bcoef[idim].define(amrex::convert(ba,IntVect::TheDimensionVector(idim)),
+                               dm, 1, 0, MFInfo(), factory);
+        }
+        phi.setVal(0.0);
+        for (MFIter mfi(acoef); mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mfi.validbox();
+            for (IntVect iv = bx.smallEnd(); bx.contains(iv); bx.next(iv))
+            {
+                Real x[3] = {0.0, 0.0, 0.0};
+                for (int d = 0; d < AMREX_SPACEDIM; ++d) x[d] = (iv[d]+0.5)*dx[d];
+                acoef[mfi](iv) = 1.0 + x[0]*x[1] + x[2];
+                beb[mfi](iv) = 2.0 + std::sin(2.0*M_PI*x[0])*std::cos(2.0*M_PI*x[1]);
+                phieb[mfi](iv) = std::cos(M_PI*x[0]) + x[1]*x[2];
+            }
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
+            {
+                const Box& fbx = amrex::surroundingNodes(bx,idim);
+                for (IntVect iv = fbx.smallEnd(); fbx.contains(iv); fbx.next(iv))
+                {
+                    Real x[3] = {0.0, 0.0, 0.0};
+                    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                        x[d] = (d == idim) ? iv[d]*dx[d] : (iv[d]+0.5)*dx[d];
+                    }
+                    bcoef[idim][mfi](iv) = 1.0 + 0.5*std::sin(3.0*x[0]+idim)*std::cos(2.0*x[1]) + x[2];
+                }
+            }
+        }
+
+        for (int is_dirichlet = 0; is_dirichlet < 2; ++is_dirichlet)
+        {
+            const std::string name = (is_dirichlet) ? "Dirichlet EB" : "Neumann EB";
+
+            TestEBABecLap op({geom}, {ba}, {dm}, LPInfo(), {&factory});
+            op.setDomainBC({AMREX_D_DECL(LinOpBCType::Dirichlet,
+                                         LinOpBCType::Dirichlet,
+                                         LinOpBCType::Dirichlet)},
+                           {AMREX_D_DECL(LinOpBCType::Neumann,
+                                         LinOpBCType::Dirichlet,
+                                         LinOpBCType::Dirichlet)});
+            op.setLevelBC(0, &phi);
+            op.setScalars(1.0, 1.0);
+            op.setACoeffs(0, acoef);
+            op.setBCoeffs(0, amrex::GetArrOfConstPtrs(bcoef));
+            if (is_dirichlet) {
+                op.setEBDirichlet(0, phieb, beb);
+            }
+            op.setup();
+
+            const int nmglevs = (is_dirichlet) ? 1 : op.numMGLevels();
+            for (int mglev = 0; mglev < nmglevs; ++mglev) {
+                check(op, mglev, (is_dirichlet) ? &beb : nullptr, (is_dirichlet) ? &phieb : nullptr,
+                      nsweeps, tol, verbose, name);
+            }
+            amrex::Print() << "EBStencil: " << name << " checked on " << nmglevs
+                           << " MG level(s)\n";
+        }
+
+        amrex::Print() << "EBStencil: passed\n";
+    }
+    amrex::Finalize();
+}
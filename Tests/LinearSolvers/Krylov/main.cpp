@@ -0,0 +1,239 @@
+#include <AMReX.H>
+#include <AMReX_Print.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_MultiFabUtil.H>
+#include <AMReX_MLABecLaplacian.H>
+#include <AMReX_MLMG.H>
+
+#include <cmath>
+#include <iomanip>
+
+using namespace amrex;
+
+//
+// Solve an ABecLaplacian problem whose b coefficient jumps by a factor
+// of contrast (1.e5 by default) across a few spherical inclusions, with
+// plain MLMG and with MLMG preconditioned CG, BiCGStab and FGMRES, on
+// one level and on two AMR levels.  Every solve has to reach the
+// tolerance, checked with the true residual, and the Krylov solutions
+// have to agree with the plain MLMG one.  The number of iterations of
+// each solver is printed.  CG is only run on one level, because the
+// composite operator is not symmetric across the coarse/fine boundary.
+//
+// With full coarsening the coarse MG levels no longer resolve the
+// inclusions and plain MLMG stalls, so the reference solve stops
+// coarsening after ref_max_coarsening_level levels.  The Krylov solvers
+// use full coarsening.  The residual cannot drop much below
+// contrast*epsilon relative to the right-hand side, hence the default
+// tolerance.
+//
+
+namespace {
+
+struct Problem
+{
+    Vector<Geometry> geom;
+    Vector<BoxArray> grids;
+    Vector<DistributionMapping> dmap;
+    Vector<MultiFab> acoef;
+    Vector<Array<MultiFab,AMREX_SPACEDIM> > bcoef;
+    Vector<MultiFab> rhs;
+};
+
+Problem make_problem (int n_cell, int max_grid_size, int nlevels, Real contrast)
+{
+    Problem p;
+    p.geom.resize(nlevels);
+    p.grids.resize(nlevels);
+    p.dmap.resize(nlevels);
+    p.acoef.resize(nlevels);
+    p.bcoef.resize(nlevels);
+    p.rhs.resize(nlevels);
+
+    RealBox rb({AMREX_D_DECL(0.,0.,0.)}, {AMREX_D_DECL(1.,1.,1.)});
+    Array<int,AMREX_SPACEDIM> is_periodic{AMREX_D_DECL(0,0,0)};
+    Box domain(IntVect(AMREX_D_DECL(0,0,0)),
+               IntVect(AMREX_D_DECL(n_cell-1,n_cell-1,n_cell-1)));
+    for (int ilev = 0; ilev < nlevels; ++ilev)
+    {
+        p.geom[ilev].define(domain, &rb, CoordSys::cartesian, is_periodic.data());
+        if (ilev == 0) {
+            p.grids[ilev].define(domain);
+        } else {
+            // the middle half of the domain
+            Box b = domain;
+            b.grow(-n_cell/2);
+            p.grids[ilev].define(b);
+        }
+        p.grids[ilev].maxSize(max_grid_size);
+        p.dmap[ilev].define(p.grids[ilev]);
+        domain.refine(2);
+    }
+
+    // inclusions: center and radius
+    const Real inclusions[3][4] = {{0.35, 0.40, 0.50, 0.15},
+                                   {0.70, 0.65, 0.40, 0.12},
+                                   {0.55, 0.30, 0.70, 0.08}};
+
+    for (int ilev = 0; ilev < nlevels; ++ilev)
+    {
+        const BoxArray& ba = p.grids[ilev];
+        const DistributionMapping& dm = p.dmap[ilev];
+        const Real* dx = p.geom[ilev].CellSize();
+
+        p.acoef[ilev].define(ba, dm, 1, 0);
+        p.rhs[ilev].define(ba, dm, 1, 0);
+        MultiFab bcc(ba, dm, 1, 1);
+        for (MFIter mfi(bcc); mfi.isValid(); ++mfi)
+        {
+            const Box& gbx = mfi.fabbox();
+            const Box& vbx = mfi.validbox();
+            for (IntVect iv = gbx.smallEnd(); gbx.contains(iv); gbx.next(iv))
+            {
+                Real x[3] = {0.5, 0.5, 0.5};
+                for (int d = 0; d < AMREX_SPACEDIM; ++d) x[d] = (iv[d]+0.5)*dx[d];
+                bcc[mfi](iv) = 1.0;
+                for (const auto& c : inclusions) {
+                    const Real r2 = (x[0]-c[0])*(x[0]-c[0]) + (x[1]-c[1])*(x[1]-c[1])
+                        + (x[2]-c[2])*(x[2]-c[2]);
+                    if (r2 < c[3]*c[3]) bcc[mfi](iv) = contrast;
+                }
+                if (vbx.contains(iv)) {
+                    p.acoef[ilev][mfi](iv) = 0.0;
+                    p.rhs[ilev][mfi](iv) = std::sin(2.0*M_PI*x[0])*std::sin(3.0*M_PI*x[1])
+                        + std::exp(-50.0*((x[0]-0.6)*(x[0]-0.6) + (x[2]-0.3)*(x[2]-0.3)));
+                }
+            }
+        }
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            p.bcoef[ilev][idim].define(amrex::convert(ba,IntVect::TheDimensionVector(idim)),
+                                       dm, 1, 0);
+        }
+        amrex::average_cellcenter_to_face(amrex::GetArrOfPtrs(p.bcoef[ilev]), bcc, p.geom[ilev]);
+    }
+    return p;
+}
+
+// Solves the problem and returns the number of iterations.  sol is
+// overwritten and the true residual, max norm over all levels, is put
+// in resnorm.
+int solve (const Problem& p, Vector<MultiFab>& sol, MLMG::KrylovSolver krylov,
+           const LPInfo& info, Real tol_rel, int verbose, Real& resnorm)
+{
+    const int nlevels = p.geom.size();
+    MLABecLaplacian mlabec(p.geom, p.grids, p.dmap, info);
+    mlabec.setDomainBC({AMREX_D_DECL(LinOpBCType::Dirichlet,
+                                     LinOpBCType::Dirichlet,
+                                     LinOpBCType::Dirichlet)},
+                       {AMREX_D_DECL(LinOpBCType::Dirichlet,
+                                     LinOpBCType::Dirichlet,
+                                     LinOpBCType::Dirichlet)});
+    sol.clear();
+    for (int ilev = 0; ilev < nlevels; ++ilev) {
+        sol.emplace_back(p.grids[ilev], p.dmap[ilev], 1, 1);
+        sol[ilev].setVal(0.0);
+        mlabec.setLevelBC(ilev, &sol[ilev]);
+    }
+    mlabec.setScalars(0.0, 1.0);
+    for (int ilev = 0; ilev < nlevels; ++ilev) {
+        mlabec.setACoeffs(ilev, p.acoef[ilev]);
+        mlabec.setBCoeffs(ilev, amrex::GetArrOfConstPtrs(p.bcoef[ilev]));
+    }
+
+    MLMG mlmg(mlabec);
+    mlmg.setVerbose(verbose);
+    mlmg.setMaxIter(500);
+    mlmg.setKrylovSolver(krylov);
+    mlmg.solve(amrex::GetVecOfPtrs(sol), amrex::GetVecOfConstPtrs(p.rhs), tol_rel, 0.0);
+
+    Vector<MultiFab> res(nlevels);
+    for (int ilev = 0; ilev < nlevels; ++ilev) {
+        res[ilev].define(p.grids[ilev], p.dmap[ilev], 1, 0);
+    }
+    mlmg.compResidual(amrex::GetVecOfPtrs(res), amrex::GetVecOfPtrs(sol),
+                      amrex::GetVecOfConstPtrs(p.rhs));
+    resnorm = 0.0;
+    for (int ilev = 0; ilev < nlevels; ++ilev) {
+        resnorm = std::max(resnorm, res[ilev].norm0());
+    }
+    return mlmg.getNumIters();
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+    {
+        int n_cell = 32;
+        int max_grid_size = 16;
+        Real contrast = 1.e5;
+        Real tol_rel = 1.e-7;
+        int ref_max_coarsening_level = 1;
+        int verbose = 0;
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("max_grid_size", max_grid_size);
+            pp.query("contrast", contrast);
+            pp.query("tol_rel", tol_rel);
+            pp.query("ref_max_coarsening_level", ref_max_coarsening_level);
+            pp.query("verbose", verbose);
+        }
+
+        struct Solver { const char* name; MLMG::KrylovSolver type; int max_nlevels; };
+        const Solver solvers[] = {{"MLMG", MLMG::KrylovSolver::none, 2},
+                                  {"CG", MLMG::KrylovSolver::cg, 1},
+                                  {"BiCGStab", MLMG::KrylovSolver::bicgstab, 2},
+                                  {"FGMRES", MLMG::KrylovSolver::fgmres, 2}};
+
+        for (int nlevels = 1; nlevels <= 2; ++nlevels)
+        {
+            const Problem p = make_problem(n_cell, max_grid_size, nlevels, contrast);
+            Real bnorm = 0.0;
+            for (const MultiFab& mf : p.rhs) bnorm = std::max(bnorm, mf.norm0());
+
+            amrex::Print() << "Krylov: " << nlevels << " level(s), contrast " << contrast << "\n"
+                           << "  solver     iters         resid/bnorm   solution difference\n";
+
+            Vector<MultiFab> sol_mlmg;
+            Real solnorm = 0.0;
+            for (const Solver& s : solvers)
+            {
+                if (nlevels > s.max_nlevels) continue;
+
+                Vector<MultiFab> sol;
+                Real resnorm;
+                LPInfo info;
+                if (s.type == MLMG::KrylovSolver::none) {
+                    info.setMaxCoarseningLevel(ref_max_coarsening_level);
+                }
+                const int niters = solve(p, sol, s.type, info, tol_rel, verbose, resnorm);
+
+                Real diff = 0.0;
+                if (s.type == MLMG::KrylovSolver::none) {
+                    for (int ilev = 0; ilev < nlevels; ++ilev) {
+                        solnorm = std::max(solnorm, sol[ilev].norm0());
+                    }
+                    sol_mlmg = std::move(sol);
+                } else {
+                    for (int ilev = 0; ilev < nlevels; ++ilev) {
+                        MultiFab::Subtract(sol[ilev], sol_mlmg[ilev], 0, 0, 1, 0);
+                        diff = std::max(diff, sol[ilev].norm0());
+                    }
+                    diff /= solnorm;
+                }
+
+                amrex::Print() << "  " << std::left << std::setw(10) << s.name << std::right
+                               << std::setw(6) << niters << std::setw(20) << resnorm/bnorm
+                               << std::setw(22) << diff << "\n";
+
+                AMREX_ALWAYS_ASSERT(resnorm <= tol_rel*bnorm);
+                AMREX_ALWAYS_ASSERT(diff <= 100.0*tol_rel);
+            }
+        }
+
+        amrex::Print() << "Krylov: passed\n";
+    }
+    amrex::Finalize();
+}
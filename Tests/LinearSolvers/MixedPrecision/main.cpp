@@ -0,0 +1,215 @@
+#include <AMReX.H>
+#include <AMReX_Print.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_MultiFabUtil.H>
+#include <AMReX_MLABecLaplacian.H>
+#include <AMReX_MLMG.H>
+
+#include <cmath>
+#include <iomanip>
+
+using namespace amrex;
+
+//
+// Solve a variable-coefficient ABecLaplacian problem with all-double
+// cycles and with single precision cycles (setSinglePrecisionCycle), on
+// one level with V- and F-cycles and on two AMR levels.  The mixed
+// precision solve has to reach the same double precision tolerance,
+// checked with the true residual, in about the same number of
+// iterations.  The residual after each iteration of both solves is
+// printed side by side.
+//
+
+namespace {
+
+struct Problem
+{
+    Vector<Geometry> geom;
+    Vector<BoxArray> grids;
+    Vector<DistributionMapping> dmap;
+    Vector<MultiFab> acoef;
+    Vector<Array<MultiFab,AMREX_SPACEDIM> > bcoef;
+    Vector<MultiFab> rhs;
+};
+
+Problem make_problem (int n_cell, int max_grid_size, int nlevels)
+{
+    Problem p;
+    p.geom.resize(nlevels);
+    p.grids.resize(nlevels);
+    p.dmap.resize(nlevels);
+    p.acoef.resize(nlevels);
+    p.bcoef.resize(nlevels);
+    p.rhs.resize(nlevels);
+
+    RealBox rb({AMREX_D_DECL(0.,0.,0.)}, {AMREX_D_DECL(1.,1.,1.)});
+    Array<int,AMREX_SPACEDIM> is_periodic{AMREX_D_DECL(0,0,0)};
+    Box domain(IntVect(AMREX_D_DECL(0,0,0)),
+               IntVect(AMREX_D_DECL(n_cell-1,n_cell-1,n_cell-1)));
+    for (int ilev = 0; ilev < nlevels; ++ilev)
+    {
+        p.geom[ilev].define(domain, &rb, CoordSys::cartesian, is_periodic.data());
+        if (ilev == 0) {
+            p.grids[ilev].define(domain);
+        } else {
+            // the middle half of the domain
+            Box b = domain;
+            b.grow(-n_cell/2);
+            p.grids[ilev].define(b);
+        }
+        p.grids[ilev].maxSize(max_grid_size);
+        p.dmap[ilev].define(p.grids[ilev]);
+        domain.refine(2);
+    }
+
+    for (int ilev = 0; ilev < nlevels; ++ilev)
+    {
+        const BoxArray& ba = p.grids[ilev];
+        const DistributionMapping& dm = p.dmap[ilev];
+        const Real* dx = p.geom[ilev].CellSize();
+
+        p.acoef[ilev].define(ba, dm, 1, 0);
+        p.rhs[ilev].define(ba, dm, 1, 0);
+        MultiFab bcc(ba, dm, 1, 1);
+        for (MFIter mfi(bcc); mfi.isValid(); ++mfi)
+        {
+            const Box& gbx = mfi.fabbox();
+            const Box& vbx = mfi.validbox();
+            for (IntVect iv = gbx.smallEnd(); gbx.contains(iv); gbx.next(iv))
+            {
+                Real x[3] = {0.0, 0.0, 0.0};
+                for (int d = 0; d < AMREX_SPACEDIM; ++d) x[d] = (iv[d]+0.5)*dx[d];
+                bcc[mfi](iv) = 1.0 + 0.9*std::sin(4.0*M_PI*x[0])*std::cos(2.0*M_PI*x[1]);
+                if (vbx.contains(iv)) {
+                    p.acoef[ilev][mfi](iv) = 1.0 + x[0]*x[1];
+                    p.rhs[ilev][mfi](iv) = std::exp(-20.0*((x[0]-0.4)*(x[0]-0.4)
+                                                           + (x[1]-0.6)*(x[1]-0.6)))
+                        + std::sin(3.0*M_PI*x[2]);
+                }
+            }
+        }
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            p.bcoef[ilev][idim].define(amrex::convert(ba,IntVect::TheDimensionVector(idim)),
+                                       dm, 1, 0);
+        }
+        amrex::average_cellcenter_to_face(amrex::GetArrOfPtrs(p.bcoef[ilev]), bcc, p.geom[ilev]);
+    }
+    return p;
+}
+
+// Solves the problem and returns the residual history.  sol is
+// overwritten and the true residual, max norm over all levels, is put
+// in resnorm.
+Vector<Real> solve (const Problem& p, Vector<MultiFab>& sol, int single_precision,
+                    int fmg_iter, Real tol_rel, int verbose, Real& resnorm)
+{
+    const int nlevels = p.geom.size();
+    MLABecLaplacian mlabec(p.geom, p.grids, p.dmap);
+    mlabec.setDomainBC({AMREX_D_DECL(LinOpBCType::Dirichlet,
+                                     LinOpBCType::Dirichlet,
+                                     LinOpBCType::Dirichlet)},
+                       {AMREX_D_DECL(LinOpBCType::Dirichlet,
+                                     LinOpBCType::Dirichlet,
+                                     LinOpBCType::Dirichlet)});
+    sol.clear();
+    for (int ilev = 0; ilev < nlevels; ++ilev) {
+        sol.emplace_back(p.grids[ilev], p.dmap[ilev], 1, 1);
+        sol[ilev].setVal(0.0);
+        mlabec.setLevelBC(ilev, &sol[ilev]);
+    }
+    mlabec.setScalars(1.0, 1.0);
+    for (int ilev = 0; ilev < nlevels; ++ilev) {
+        mlabec.setACoeffs(ilev, p.acoef[ilev]);
+        mlabec.setBCoeffs(ilev, amrex::GetArrOfConstPtrs(p.bcoef[ilev]));
+    }
+
+    MLMG mlmg(mlabec);
+    mlmg.setVerbose(verbose);
+    mlmg.setMaxFmgIter(fmg_iter);
+    mlmg.setSinglePrecisionCycle(single_precision);
+    mlmg.solve(amrex::GetVecOfPtrs(sol), amrex::GetVecOfConstPtrs(p.rhs), tol_rel, 0.0);
+    AMREX_ALWAYS_ASSERT(mlmg.usingSinglePrecisionCycle() == bool(single_precision));
+
+    Vector<MultiFab> res(nlevels);
+    for (int ilev = 0; ilev < nlevels; ++ilev) {
+        res[ilev].define(p.grids[ilev], p.dmap[ilev], 1, 0);
+    }
+    mlmg.compResidual(amrex::GetVecOfPtrs(res), amrex::GetVecOfPtrs(sol),
+                      amrex::GetVecOfConstPtrs(p.rhs));
+    resnorm = 0.0;
+    for (int ilev = 0; ilev < nlevels; ++ilev) {
+        resnorm = std::max(resnorm, res[ilev].norm0());
+    }
+    return mlmg.getResidualHistory();
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+    {
+        int n_cell = 64;
+        int max_grid_size = 32;
+        Real tol_rel = 1.e-11;
+        int verbose = 0;
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("max_grid_size", max_grid_size);
+            pp.query("tol_rel", tol_rel);
+            pp.query("verbose", verbose);
+        }
+
+        struct Case { const char* name; int nlevels; int fmg_iter; };
+        const Case cases[] = {{"1 level, V-cycle", 1, 0},
+                              {"1 level, F-cycle", 1, 100},
+                              {"2 levels, V-cycle", 2, 0}};
+
+        for (const Case& c : cases)
+        {
+            const Problem p = make_problem(n_cell, max_grid_size, c.nlevels);
+            Real bnorm = 0.0;
+            for (const MultiFab& mf : p.rhs) bnorm = std::max(bnorm, mf.norm0());
+
+            Vector<MultiFab> sol_d, sol_s;
+            Real res_d, res_s;
+            const Vector<Real> hist_d = solve(p, sol_d, 0, c.fmg_iter, tol_rel, verbose, res_d);
+            const Vector<Real> hist_s = solve(p, sol_s, 1, c.fmg_iter, tol_rel, verbose, res_s);
+
+            amrex::Print() << "MixedPrecision: " << c.name << "\n"
+                           << "  iter   resid/bnorm double   resid/bnorm single\n";
+            const int niter = std::max(hist_d.size(), hist_s.size());
+            for (int i = 0; i < niter; ++i) {
+                amrex::Print() << "  " << std::setw(4) << i+1;
+                if (i < hist_d.size()) {
+                    amrex::Print() << std::setw(21) << hist_d[i];
+                } else {
+                    amrex::Print() << std::setw(21) << "";
+                }
+                if (i < hist_s.size()) {
+                    amrex::Print() << std::setw(21) << hist_s[i];
+                }
+                amrex::Print() << "\n";
+            }
+
+            Real diff = 0.0, solnorm = 0.0;
+            for (int ilev = 0; ilev < c.nlevels; ++ilev) {
+                MultiFab::Subtract(sol_s[ilev], sol_d[ilev], 0, 0, 1, 0);
+                diff = std::max(diff, sol_s[ilev].norm0());
+                solnorm = std::max(solnorm, sol_d[ilev].norm0());
+            }
+            amrex::Print() << "  true resid/bnorm " << res_d/bnorm << " double, "
+                           << res_s/bnorm << " single; max solution difference "
+                           << diff/solnorm << " relative\n";
+
+            AMREX_ALWAYS_ASSERT(res_d <= tol_rel*bnorm);
+            AMREX_ALWAYS_ASSERT(res_s <= tol_rel*bnorm);
+            AMREX_ALWAYS_ASSERT(hist_s.size() <= hist_d.size()+2);
+            AMREX_ALWAYS_ASSERT(diff <= 1.e-8*solnorm);
+        }
+
+        amrex::Print() << "MixedPrecision: passed\n";
+    }
+    amrex::Finalize();
+}
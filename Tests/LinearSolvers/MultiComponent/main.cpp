@@ -0,0 +1,173 @@
+#include <AMReX.H>
+#include <AMReX_Print.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_MultiFabUtil.H>
+#include <AMReX_MLABecLaplacian.H>
+#include <AMReX_MLMG.H>
+
+#include <cmath>
+
+using namespace amrex;
+
+//
+// Solve ncomp right-hand sides with one multi-component
+// MLABecLaplacian, and each of them with its own single-component
+// solve, and check that the solutions agree.  The last component has
+// zero rhs and zero boundary values, so its rhs and initial residual
+// norms are both zero and its solution has to stay exactly zero.
+//
+
+namespace {
+
+void init_rhs_bc (MultiFab& rhs, MultiFab& phi, const Geometry& geom, int ncomp)
+{
+    const Real* dx = geom.CellSize();
+    const Box& domain = geom.Domain();
+    for (MFIter mfi(rhs); mfi.isValid(); ++mfi)
+    {
+        const Box& vbx = mfi.validbox();
+        const Box& gbx = mfi.growntilebox(1);
+        for (int n = 0; n < ncomp; ++n)
+        {
+            // Only the last component is zero everywhere.
+            const Real f = (n == ncomp-1) ? 0.0 : Real(n+1);
+            for (IntVect iv = gbx.smallEnd(); gbx.contains(iv); gbx.next(iv))
+            {
+                Real x[3] = {0.0, 0.0, 0.0};
+                for (int d = 0; d < AMREX_SPACEDIM; ++d) x[d] = (iv[d]+0.5)*dx[d];
+                if (vbx.contains(iv)) {
+                    rhs[mfi](iv,n) = f*std::sin(2.0*M_PI*f*x[0]) * std::cos(M_PI*x[1])
+                        + f*x[AMREX_SPACEDIM-1];
+                    phi[mfi](iv,n) = 0.0;
+                } else if (!domain.contains(iv)) {
+                    // Dirichlet values in the ghost cells
+                    phi[mfi](iv,n) = f*(x[0] - 0.5*x[1]);
+                } else {
+                    phi[mfi](iv,n) = 0.0;
+                }
+            }
+        }
+    }
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+    {
+        int n_cell = 64;
+        int max_grid_size = 32;
+        int ncomp = 3;
+        int verbose = 1;
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("max_grid_size", max_grid_size);
+            pp.query("ncomp", ncomp);
+            pp.query("verbose", verbose);
+        }
+        AMREX_ALWAYS_ASSERT(ncomp >= 2);
+
+        Geometry geom;
+        {
+            RealBox rb({AMREX_D_DECL(0.,0.,0.)}, {AMREX_D_DECL(1.,1.,1.)});
+            Array<int,AMREX_SPACEDIM> is_periodic{AMREX_D_DECL(0,0,0)};
+            Box domain(IntVect(AMREX_D_DECL(0,0,0)),
+                       IntVect(AMREX_D_DECL(n_cell-1,n_cell-1,n_cell-1)));
+            geom.define(domain, &rb, CoordSys::cartesian, is_periodic.data());
+        }
+        BoxArray ba(geom.Domain());
+        ba.maxSize(max_grid_size);
+        DistributionMapping dm(ba);
+
+        // Variable coefficients
+        MultiFab acoef(ba, dm, 1, 0);
+        MultiFab bcc(ba, dm, 1, 1);
+        const Real* dx = geom.CellSize();
+        for (MFIter mfi(bcc); mfi.isValid(); ++mfi)
+        {
+            const Box& gbx = mfi.fabbox();
+            for (IntVect iv = gbx.smallEnd(); gbx.contains(iv); gbx.next(iv))
+            {
+                const Real x = (iv[0]+0.5)*dx[0];
+                const Real y = (iv[1]+0.5)*dx[1];
+                bcc[mfi](iv) = 1.0 + 0.5*std::sin(4.0*M_PI*x)*std::sin(2.0*M_PI*y);
+            }
+            const Box& vbx = mfi.validbox();
+            for (IntVect iv = vbx.smallEnd(); vbx.contains(iv); vbx.next(iv))
+            {
+                acoef[mfi](iv) = 1.0 + (iv[0]+0.5)*dx[0];
+            }
+        }
+        Array<MultiFab,AMREX_SPACEDIM> bcoef;
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            bcoef[idim].define(amrex::convert(ba,IntVect::TheDimensionVector(idim)), dm, 1, 0);
+        }
+        amrex::average_cellcenter_to_face(amrex::GetArrOfPtrs(bcoef), bcc, geom);
+
+        MultiFab rhs(ba, dm, ncomp, 0);
+        MultiFab phi(ba, dm, ncomp, 1);
+        init_rhs_bc(rhs, phi, geom, ncomp);
+
+        const Real tol_rel = 1.e-12;
+        const Real tol_abs = 0.0;
+
+        auto solve = [&] (MultiFab& sol, const MultiFab& b, int nc) -> int
+        {
+            MLABecLaplacian mlabec({geom}, {ba}, {dm}, LPInfo(), {}, nc);
+            mlabec.setDomainBC({AMREX_D_DECL(LinOpBCType::Dirichlet,
+                                             LinOpBCType::Dirichlet,
+                                             LinOpBCType::Dirichlet)},
+                               {AMREX_D_DECL(LinOpBCType::Dirichlet,
+                                             LinOpBCType::Dirichlet,
+                                             LinOpBCType::Dirichlet)});
+            mlabec.setLevelBC(0, &sol);
+            mlabec.setScalars(1.0, 1.0);
+            mlabec.setACoeffs(0, acoef);
+            mlabec.setBCoeffs(0, amrex::GetArrOfConstPtrs(bcoef));
+
+            MLMG mlmg(mlabec);
+            mlmg.setVerbose(verbose);
+            mlmg.solve({&sol}, {&b}, tol_rel, tol_abs);
+            for (Real r : mlmg.getResidualHistory()) {
+                AMREX_ALWAYS_ASSERT(std::isfinite(r));
+            }
+            return mlmg.getNumIters();
+        };
+
+        const int iters = solve(phi, rhs, ncomp);
+        amrex::Print() << "MultiComponent: " << ncomp << " components in one solve, "
+                       << iters << " iterations\n";
+
+        // The zero component must not be touched.
+        AMREX_ALWAYS_ASSERT(phi.norm0(ncomp-1) == 0.0);
+
+        for (int n = 0; n < ncomp; ++n)
+        {
+            MultiFab rhs1(ba, dm, 1, 0);
+            MultiFab phi1(ba, dm, 1, 1);
+            MultiFab::Copy(rhs1, rhs, n, 0, 1, 0);
+            {
+                MultiFab rhs_all(ba, dm, ncomp, 0);
+                MultiFab phi_all(ba, dm, ncomp, 1);
+                init_rhs_bc(rhs_all, phi_all, geom, ncomp);
+                MultiFab::Copy(phi1, phi_all, n, 0, 1, 1);
+            }
+            const int iters1 = solve(phi1, rhs1, 1);
+
+            MultiFab diff(ba, dm, 1, 0);
+            MultiFab::Copy(diff, phi1, 0, 0, 1, 0);
+            MultiFab::Subtract(diff, phi, n, 0, 1, 0);
+            const Real err = diff.norm0();
+            const Real scale = std::max(phi1.norm0(), Real(1.e-300));
+            amrex::Print() << "MultiComponent: component " << n << ", " << iters1
+                           << " iterations alone, max difference " << err
+                           << " (relative " << err/scale << ")\n";
+            AMREX_ALWAYS_ASSERT(err <= 1.e-9*scale);
+        }
+
+        amrex::Print() << "MultiComponent: passed\n";
+    }
+    amrex::Finalize();
+}
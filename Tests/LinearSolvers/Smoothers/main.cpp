@@ -0,0 +1,221 @@
+#include <AMReX.H>
+#include <AMReX_Print.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_MultiFabUtil.H>
+#include <AMReX_MLABecLaplacian.H>
+#include <AMReX_MLMG.H>
+
+#include <cmath>
+
+using namespace amrex;
+
+//
+// Solve a two-component variable-coefficient ABecLaplacian problem
+// with each smoother type and check that L1-Jacobi and Chebyshev
+// converge to the red-black Gauss-Seidel solution.  The two components
+// have different right-hand sides, several orders of magnitude apart.
+// For each smoother the inverse diagonal is checked against the
+// stencil away from the domain boundary, and for Chebyshev the
+// lambda_max of every MG level and component is checked against a long
+// power iteration.
+//
+
+namespace {
+
+// Gives access to the smoother data of MLCellLinOp.
+class TestABecLap
+    : public MLABecLaplacian
+{
+public:
+    using MLABecLaplacian::MLABecLaplacian;
+
+    const MultiFab& invDiag (int mglev) const { return m_smoother_invdiag[0][mglev]; }
+    Real lambdaMax (int mglev, int n) const { return m_cheby_lambda_max[0][mglev][n]; }
+
+    // Largest eigenvalue of D^{-1} A for component n, from niters power
+    // iterations on the MG level.
+    Real powerLambdaMax (int mglev, int n, int niters) const
+    {
+        const int ncomp = getNComp();
+        const BoxArray& ba = m_grids[0][mglev];
+        const DistributionMapping& dm = m_dmap[0][mglev];
+        MultiFab v(ba, dm, ncomp, 1);
+        MultiFab Av(ba, dm, ncomp, 0);
+        v.setVal(0.0);
+        for (MFIter mfi(v); mfi.isValid(); ++mfi) {
+            const Box& bx = mfi.validbox();
+            for (IntVect iv = bx.smallEnd(); bx.contains(iv); bx.next(iv)) {
+                v[mfi](iv,n) = amrex::Random() - 0.5;
+            }
+        }
+        Real lambda = 0.0;
+        for (int iter = 0; iter < niters; ++iter) {
+            v.mult(1.0/v.norm2(n), n, 1, 0);
+            applyBC(0, mglev, v, BCMode::Homogeneous, StateMode::Solution);
+            Fapply(0, mglev, Av, v);
+            MultiFab::Multiply(Av, invDiag(mglev), n, n, 1, 0);
+            MultiFab::Copy(v, Av, n, n, 1, 0);
+            lambda = v.norm2(n);
+        }
+        return lambda;
+    }
+
+    int numMGLevels () const { return NMGLevels(0); }
+};
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+    {
+        int n_cell = 64;
+        int max_grid_size = 32;
+        Real tol_rel = 1.e-11;
+        int verbose = 0;
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("max_grid_size", max_grid_size);
+            pp.query("tol_rel", tol_rel);
+            pp.query("verbose", verbose);
+        }
+        const int ncomp = 2;
+        const Real ascalar = 1.0;
+        const Real bscalar = 1.0;
+
+        Geometry geom;
+        {
+            RealBox rb({AMREX_D_DECL(0.,0.,0.)}, {AMREX_D_DECL(1.,1.,1.)});
+            Array<int,AMREX_SPACEDIM> is_periodic{AMREX_D_DECL(0,0,0)};
+            Box domain(IntVect(AMREX_D_DECL(0,0,0)),
+                       IntVect(AMREX_D_DECL(n_cell-1,n_cell-1,n_cell-1)));
+            geom.define(domain, &rb, CoordSys::cartesian, is_periodic.data());
+        }
+        BoxArray ba(geom.Domain());
+        ba.maxSize(max_grid_size);
+        DistributionMapping dm(ba);
+        const Real* dx = geom.CellSize();
+
+        MultiFab acoef(ba, dm, 1, 0);
+        MultiFab bcc(ba, dm, 1, 1);
+        MultiFab rhs(ba, dm, ncomp, 0);
+        for (MFIter mfi(bcc); mfi.isValid(); ++mfi)
+        {
+            const Box& gbx = mfi.fabbox();
+            const Box& vbx = mfi.validbox();
+            for (IntVect iv = gbx.smallEnd(); gbx.contains(iv); gbx.next(iv))
+            {
+                Real x[3] = {0.0, 0.0, 0.0};
+                for (int d = 0; d < AMREX_SPACEDIM; ++d) x[d] = (iv[d]+0.5)*dx[d];
+                bcc[mfi](iv) = 1.0 + 0.9*std::sin(4.0*M_PI*x[0])*std::sin(2.0*M_PI*x[1]);
+                if (vbx.contains(iv)) {
+                    acoef[mfi](iv) = 1.0 + x[2];
+                    rhs[mfi](iv,0) = std::sin(2.0*M_PI*x[0])*std::cos(3.0*M_PI*x[1]) + x[2];
+                    rhs[mfi](iv,1) = 1.e4*std::exp(-30.0*((x[0]-0.3)*(x[0]-0.3)
+                                                          + (x[1]-0.7)*(x[1]-0.7)));
+                }
+            }
+        }
+        Array<MultiFab,AMREX_SPACEDIM> bcoef;
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            bcoef[idim].define(amrex::convert(ba,IntVect::TheDimensionVector(idim)), dm, 1, 0);
+        }
+        amrex::average_cellcenter_to_face(amrex::GetArrOfPtrs(bcoef), bcc, geom);
+
+        struct Case { const char* name; MLLinOp::SmootherType type; int degree; };
+        const Case cases[] = {{"GSRB", MLLinOp::SmootherType::Default, 0},
+                              {"L1Jacobi", MLLinOp::SmootherType::L1Jacobi, 0},
+                              {"Chebyshev degree 2", MLLinOp::SmootherType::Chebyshev, 2},
+                              {"Chebyshev degree 4", MLLinOp::SmootherType::Chebyshev, 4}};
+
+        MultiFab sol_gsrb(ba, dm, ncomp, 0);
+        Vector<Real> solnorm(ncomp);
+
+        for (const Case& c : cases)
+        {
+            TestABecLap mlabec({geom}, {ba}, {dm}, LPInfo(), {}, ncomp);
+            mlabec.setDomainBC({AMREX_D_DECL(LinOpBCType::Dirichlet,
+                                             LinOpBCType::Dirichlet,
+                                             LinOpBCType::Dirichlet)},
+                               {AMREX_D_DECL(LinOpBCType::Dirichlet,
+                                             LinOpBCType::Dirichlet,
+                                             LinOpBCType::Dirichlet)});
+            MultiFab sol(ba, dm, ncomp, 1);
+            sol.setVal(0.0);
+            mlabec.setLevelBC(0, &sol);
+            mlabec.setScalars(ascalar, bscalar);
+            mlabec.setACoeffs(0, acoef);
+            mlabec.setBCoeffs(0, amrex::GetArrOfConstPtrs(bcoef));
+            mlabec.setSmoother(c.type);
+            if (c.degree > 0) mlabec.setChebyshevDegree(c.degree);
+
+            MLMG mlmg(mlabec);
+            mlmg.setVerbose(verbose);
+            mlmg.solve({&sol}, {&rhs}, tol_rel, 0.0);
+            amrex::Print() << "Smoothers: " << c.name << ", " << mlmg.getNumIters()
+                           << " iterations";
+
+            if (c.type == MLLinOp::SmootherType::Default)
+            {
+                MultiFab::Copy(sol_gsrb, sol, 0, 0, ncomp, 0);
+                for (int n = 0; n < ncomp; ++n) solnorm[n] = sol_gsrb.norm0(n);
+                amrex::Print() << "\n";
+                continue;
+            }
+
+            // Same solution as GSRB, per component
+            MultiFab::Subtract(sol, sol_gsrb, 0, 0, ncomp, 0);
+            for (int n = 0; n < ncomp; ++n) {
+                const Real err = sol.norm0(n)/solnorm[n];
+                amrex::Print() << ", component " << n << " difference " << err;
+                AMREX_ALWAYS_ASSERT(err < 1.e-8);
+            }
+            amrex::Print() << "\n";
+
+            // Inverse diagonal away from the boundary: alpha*a + beta*sum(b)/dx^2,
+            // with twice the b part for the l1 row sum.
+            const Real boff = (c.type == MLLinOp::SmootherType::L1Jacobi) ? 2.0 : 1.0;
+            const Box& interior = amrex::grow(geom.Domain(), -1);
+            const MultiFab& invdiag = mlabec.invDiag(0);
+            Real maxerr = 0.0;
+            for (MFIter mfi(invdiag); mfi.isValid(); ++mfi)
+            {
+                const Box& bx = mfi.validbox() & interior;
+                for (IntVect iv = bx.smallEnd(); bx.contains(iv); bx.next(iv))
+                {
+                    Real d = ascalar*acoef[mfi](iv);
+                    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                        const IntVect ivp = iv + IntVect::TheDimensionVector(idim);
+                        d += boff*bscalar*(bcoef[idim][mfi](iv) + bcoef[idim][mfi](ivp))
+                            / (dx[idim]*dx[idim]);
+                    }
+                    for (int n = 0; n < ncomp; ++n) {
+                        maxerr = std::max(maxerr, std::abs(invdiag[mfi](iv,n)*d - 1.0));
+                    }
+                }
+            }
+            AMREX_ALWAYS_ASSERT(maxerr < 1.e-12);
+
+                // lambda_max has to be an upper bound of the largest eigenvalue,
+            // but not by much more than the 10% safety factor.
+            if (c.type == MLLinOp::SmootherType::Chebyshev)
+            {
+                for (int mglev = 0; mglev < mlabec.numMGLevels(); ++mglev) {
+                    for (int n = 0; n < ncomp; ++n) {
+                        const Real lmax = mlabec.lambdaMax(mglev, n);
+                        const Real ref = mlabec.powerLambdaMax(mglev, n, 300);
+                        if (mglev == 0) {
+                            amrex::Print() << "  MG level 0, component " << n << ": lambda_max "
+                                           << lmax << ", 300 power iterations " << ref << "\n";
+                        }
+                        AMREX_ALWAYS_ASSERT(lmax >= ref && lmax <= 1.1*1.01*ref);
+                    }
+                }
+            }
+        }
+
+        amrex::Print() << "Smoothers: passed\n";
+    }
+    amrex::Finalize();
+}
@@ -0,0 +1,123 @@
+#include <AmrLevelAdvBox.H>
+#include <Adv_F.H>
+
+using namespace amrex;
+
+void
+AmrLevelAdvBox::beginStep (Real time, Real dt, int iteration, int ncycle)
+{
+#ifdef AMREX_PARTICLES
+    if (do_tracers) {
+        amrex::Abort("AmrLevelAdvBox: tracer particles need AmrLevelAdv::advance");
+    }
+#endif
+
+    for (int k = 0; k < NUM_STATE_TYPE; k++) {
+        state[k].allocOldData();
+        state[k].swapTimeLevels(dt);
+    }
+
+    Sborder.define(grids, dmap, NUM_STATE, NUM_GROW);
+
+    if (do_reflux)
+    {
+        for (int j = 0; j < BL_SPACEDIM; j++)
+        {
+            BoxArray ba = grids;
+            ba.surroundingNodes(j);
+            fluxes[j].define(ba, dmap, NUM_STATE, 0);
+        }
+    }
+}
+
+void
+AmrLevelAdvBox::fillPatchBox (int i, Real time)
+{
+    MultiFab tmp(BoxArray(grids[i]), DistributionMapping(Vector<int>{ParallelDescriptor::MyProc()}),
+                 NUM_STATE, NUM_GROW);
+    FillPatch(*this, tmp, NUM_GROW, time, Phi_Type, 0, NUM_STATE);
+    Sborder[i].copy(tmp[0]);
+}
+
+void
+AmrLevelAdvBox::fillPatchLevel (Real time)
+{
+    FillPatch(*this, Sborder, NUM_GROW, time, Phi_Type, 0, NUM_STATE);
+}
+
+void
+AmrLevelAdvBox::advanceBox (int i, Real time, Real dt, int iteration, int ncycle)
+{
+    // Only the data of box i is touched here.
+    MultiFab& S_new = get_new_data(Phi_Type);
+
+    const Real prev_time = state[Phi_Type].prevTime();
+    const Real cur_time = state[Phi_Type].curTime();
+    const Real ctr_time = 0.5*(prev_time + cur_time);
+
+    const Real* dx = geom.CellSize();
+    const Real* prob_lo = geom.ProbLo();
+
+    const Box& bx = grids[i];
+    const FArrayBox& statein = Sborder[i];
+    FArrayBox& stateout      =   S_new[i];
+
+    FArrayBox flux[BL_SPACEDIM], uface[BL_SPACEDIM];
+    for (int j = 0; j < BL_SPACEDIM ; j++) {
+        const Box& bxtmp = amrex::surroundingNodes(bx,j);
+        flux[j].resize(bxtmp,NUM_STATE);
+        uface[j].resize(amrex::grow(bxtmp, iteration), 1);
+    }
+
+    get_face_velocity(&level, &ctr_time,
+                      AMREX_D_DECL(BL_TO_FORTRAN(uface[0]),
+                                   BL_TO_FORTRAN(uface[1]),
+                                   BL_TO_FORTRAN(uface[2])),
+                      dx, prob_lo);
+
+    advect(&time, bx.loVect(), bx.hiVect(),
+           BL_TO_FORTRAN_3D(statein),
+           BL_TO_FORTRAN_3D(stateout),
+           AMREX_D_DECL(BL_TO_FORTRAN_3D(uface[0]),
+                        BL_TO_FORTRAN_3D(uface[1]),
+                        BL_TO_FORTRAN_3D(uface[2])),
+           AMREX_D_DECL(BL_TO_FORTRAN_3D(flux[0]),
+                        BL_TO_FORTRAN_3D(flux[1]),
+                        BL_TO_FORTRAN_3D(flux[2])),
+           dx, &dt);
+
+    if (do_reflux) {
+        for (int j = 0; j < BL_SPACEDIM ; j++) {
+            fluxes[j][i].copy(flux[j]);
+        }
+    }
+}
+
+Real
+AmrLevelAdvBox::endStep (Real time, Real dt, int iteration, int ncycle)
+{
+    // The fine steps add to the register of level+1 only after this.
+    if (do_reflux)
+    {
+        if (level > 0) {
+            for (int j = 0; j < BL_SPACEDIM ; j++) {
+                getFluxReg(level).FineAdd(fluxes[j],j,0,0,NUM_STATE,1.);
+            }
+        }
+        if (level < parent->finestLevel())
+        {
+            FluxRegister& fine = getFluxReg(level+1);
+            fine.setVal(0.0);
+            for (int j = 0; j < BL_SPACEDIM ; j++) {
+                fine.CrseInit(fluxes[j],j,0,0,NUM_STATE,-1.);
+            }
+        }
+    }
+
+    Sborder.clear();
+    for (int j = 0; j < BL_SPACEDIM ; j++) {
+        fluxes[j].clear();
+    }
+
+    return dt;
+}
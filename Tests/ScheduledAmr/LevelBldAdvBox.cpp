@@ -0,0 +1,57 @@
+
+#include <AMReX_LevelBld.H>
+#include <AmrLevelAdvBox.H>
+
+using namespace amrex;
+
+class LevelBldAdvBox
+    :
+    public LevelBld
+{
+    virtual void variableSetUp () override;
+    virtual void variableCleanUp () override;
+    virtual AmrLevel *operator() () override;
+    virtual AmrLevel *operator() (Amr&            papa,
+                                  int             lev,
+                                  const Geometry& level_geom,
+                                  const BoxArray& ba,
+				  const DistributionMapping& dm,
+                                  Real            time) override;
+};
+
+LevelBldAdvBox Adv_bld;
+
+LevelBld*
+getLevelBld ()
+{
+    return &Adv_bld;
+}
+
+void
+LevelBldAdvBox::variableSetUp ()
+{
+    AmrLevelAdv::variableSetUp();
+}
+
+void
+LevelBldAdvBox::variableCleanUp ()
+{
+    AmrLevelAdv::variableCleanUp();
+}
+
+AmrLevel*
+LevelBldAdvBox::operator() ()
+{
+    return new AmrLevelAdvBox;
+}
+
+AmrLevel*
+LevelBldAdvBox::operator() (Amr&            papa,
+	   	         int             lev,
+                         const Geometry& level_geom,
+                         const BoxArray& ba,
+                         const DistributionMapping& dm,
+                         Real            time)
+{
+    return new AmrLevelAdvBox(papa, lev, level_geom, ba, dm, time);
+}
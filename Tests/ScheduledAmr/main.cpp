@@ -0,0 +1,107 @@
+#include <AMReX.H>
+#include <AMReX_Amr.H>
+#include <AMReX_ScheduledAmr.H>
+#include <AMReX_MultiFab.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_Utility.H>
+#include <AMReX_VisMF.H>
+#include <AMReX_Print.H>
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+using namespace amrex;
+
+//
+// Advect the SingleVortex problem of Tutorials/Amr/Advection_AmrLevel
+// for max_step coarse steps with Amr, which calls AmrLevelAdv::advance,
+// and again with ScheduledAmr, which runs the box tasks of AmrLevelAdvBox,
+// and check that the two final plotfiles are the same bit for bit: the
+// headers, the grids and the data of every level.  Run it with several
+// OpenMP threads and with several MPI processes.
+//
+
+namespace {
+
+template <class AmrType>
+std::string run (const std::string& plot_file, int max_step)
+{
+    ParmParse pp("amr");
+    pp.add("plot_file", plot_file);
+
+    AmrType amr;
+    amr.init(0.0, -1.0);
+    while (amr.okToContinue() && amr.levelSteps(0) < max_step) {
+        amr.coarseTimeStep(-1.0);
+    }
+    amr.writePlotFile();
+
+    return amrex::Concatenate(plot_file, amr.levelSteps(0), 5);
+}
+
+std::string readText (const std::string& file)
+{
+    Vector<char> buf;
+    ParallelDescriptor::ReadAndBcastFile(file, buf);
+    return std::string(buf.dataPtr());
+}
+
+bool same (const MultiFab& a, const MultiFab& b)
+{
+    if (a.boxArray() != b.boxArray() || a.nComp() != b.nComp()) return false;
+    int ok = 1;
+    for (MFIter mfi(a); mfi.isValid(); ++mfi) {
+        const FArrayBox& fa = a[mfi];
+        const FArrayBox& fb = b[mfi];
+        if (fa.box() != fb.box() ||
+            std::memcmp(fa.dataPtr(), fb.dataPtr(), fa.size()*sizeof(Real)) != 0) {
+            ok = 0;
+        }
+    }
+    ParallelDescriptor::ReduceIntMin(ok);
+    return ok;
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+    {
+        int max_step = 8;
+        {
+            ParmParse pp;
+            pp.query("max_step", max_step);
+        }
+
+        const std::string plt_amr = run<Amr>("plt_amr", max_step);
+        const std::string plt_task = run<ScheduledAmr>("plt_task", max_step);
+
+        AMREX_ALWAYS_ASSERT_WITH_MESSAGE(readText(plt_amr+"/Header") == readText(plt_task+"/Header"),
+                                         "ScheduledAmr: plotfile headers differ");
+
+        int nlevs = 0;
+        for (; amrex::FileExists(plt_amr + "/Level_" + std::to_string(nlevs) + "/Cell_H"); ++nlevs)
+        {
+            const std::string cell = "/Level_" + std::to_string(nlevs) + "/Cell";
+            AMREX_ALWAYS_ASSERT(amrex::FileExists(plt_task + cell + "_H"));
+
+            // The headers list the grids, so both levels have the same.
+            MultiFab mf_amr;
+            VisMF::Read(mf_amr, plt_amr + cell);
+            MultiFab mf_task(mf_amr.boxArray(), mf_amr.DistributionMap(), mf_amr.nComp(), 0);
+            VisMF::Read(mf_task, plt_task + cell);
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(same(mf_amr, mf_task),
+                                             ("ScheduledAmr: level " + std::to_string(nlevs)
+                                              + " differs").c_str());
+        }
+        AMREX_ALWAYS_ASSERT(nlevs > 1);
+
+        amrex::Print() << "ScheduledAmr: " << plt_amr << " and " << plt_task << " with " << nlevs
+                       << " levels are the same, passed\n";
+    }
+    amrex::Finalize();
+}
@@ -151,6 +151,9 @@ set ( ENABLE_FBASELIB "DEPRECATED" CACHE STRING "Build Fortran kernel (deprecate
 print_option (ENABLE_FBASELIB)
 ################################################
 
+option ( ENABLE_AMRTASK "Build the task graph driven ScheduledAmr" OFF)
+print_option ( ENABLE_AMRTASK )
+
 option ( ENABLE_AMRDATA "Build data services" OFF)
 print_option ( ENABLE_AMRDATA )
 
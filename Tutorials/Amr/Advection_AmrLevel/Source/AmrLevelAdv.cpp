@@ -10,6 +10,7 @@ using namespace amrex;
 int      AmrLevelAdv::verbose         = 0;
 Real     AmrLevelAdv::cfl             = 0.9;
 int      AmrLevelAdv::do_reflux       = 1;
+int      AmrLevelAdv::async_reflux    = 0;
 
 int      AmrLevelAdv::NUM_STATE       = 1;  // One variable in the state
 int      AmrLevelAdv::NUM_GROW        = 3;  // number of ghost cells
@@ -336,6 +337,10 @@ AmrLevelAdv::advance (Real time,
 	if (current) {
 	    for (int i = 0; i < BL_SPACEDIM ; i++)
 		current->FineAdd(fluxes[i],i,0,0,NUM_STATE,1.);
+	    if (async_reflux)
+		current->Reflux_nowait(parent->boxArray(level-1),
+				       parent->DistributionMap(level-1),
+				       parent->Geom(level-1));
 	}
 	if (fine) {
 	    for (int i = 0; i < BL_SPACEDIM ; i++)
@@ -676,6 +681,7 @@ AmrLevelAdv::read_params ()
     pp.query("v",verbose);
     pp.query("cfl",cfl);
     pp.query("do_reflux",do_reflux);
+    pp.query("async_reflux",async_reflux);
 
     // This tutorial code only supports Cartesian coordinates.
     if (! Geometry::IsCartesian()) {